@@ -116,7 +116,9 @@ double absorb_t::composite_ta_multiplier(const action_state_t* s) const
 
 double absorb_t::composite_versatility(const action_state_t* state) const
 {
-  return spell_base_t::composite_versatility(state) + player->cache.heal_versatility();
+  return cast_snapshot_value( STATE_VERSATILITY, [ this, state ] {
+    return spell_base_t::composite_versatility( state ) + player->cache.heal_versatility();
+  } );
 }
 
 size_t absorb_t::available_targets(std::vector<player_t*>& target_list) const
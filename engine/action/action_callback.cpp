@@ -4,8 +4,17 @@
 // ==========================================================================
 
 #include "action_callback.hpp"
+#include "dbc_proc_callback.hpp"
 #include "sc_action.hpp"
 #include "player/sc_player.hpp"
+#include "sim/sc_cooldown.hpp"
+
+#include <algorithm>
+#include <typeinfo>
+
+#if defined(SC_VS)
+#include <intrin.h>
+#endif
 
 action_callback_t::action_callback_t(player_t* l, bool ap, bool asp) :
   listener(l), active(true), allow_self_procs(asp), allow_procs(ap)
@@ -32,6 +41,115 @@ void action_callback_t::trigger(const std::vector<action_callback_t*>& v, action
   }
 }
 
+void action_callback_t::set_active(bool a)
+{
+  active = a;
+
+  for (const auto& slot : dispatch_slots)
+  {
+    auto& word = slot.first->active[slot.second / 64];
+    auto bit = uint64_t(1) << (slot.second % 64);
+    word = a ? word | bit : word & ~bit;
+  }
+}
+
+void action_callback_t::dispatch_list_t::clear()
+{
+  for (const auto& entry : entries)
+  {
+    auto& slots = entry.cb->dispatch_slots;
+    slots.erase(std::remove_if(slots.begin(), slots.end(),
+                               [this](const std::pair<dispatch_list_t*, size_t>& slot) { return slot.first == this; }),
+                slots.end());
+  }
+
+  entries.clear();
+  active.clear();
+}
+
+void action_callback_t::dispatch_list_t::add(action_callback_t* cb)
+{
+  dispatch_t entry { cb, nullptr, nullptr, nullptr };
+
+  // Derived callbacks may override trigger() with different rules, only callbacks of the exact
+  // type can use the dbc_proc_callback_t fast path.
+  if (typeid(*cb) == typeid(dbc_proc_callback_t))
+  {
+    auto dbc = static_cast<dbc_proc_callback_t*>(cb);
+    entry.dbc = dbc;
+    entry.ready = dbc->cooldown ? &dbc->cooldown->ready : nullptr;
+    entry.weapon = dbc->weapon;
+  }
+
+  auto index = entries.size();
+  entries.push_back(entry);
+  if (index % 64 == 0)
+    active.push_back(0);
+  if (cb->active)
+    active[index / 64] |= uint64_t(1) << (index % 64);
+
+  cb->dispatch_slots.emplace_back(this, index);
+}
+
+namespace {
+
+unsigned lowest_bit(uint64_t v)
+{
+#if defined(SC_VS)
+  unsigned long index;
+  _BitScanForward64(&index, v);
+  return index;
+#else
+  return static_cast<unsigned>(__builtin_ctzll(v));
+#endif
+}
+
+// Trigger an active callback of a dispatch table. Returns false if the rest of the table is skipped.
+bool dispatch(const action_callback_t::dispatch_t& entry, action_t* a, action_state_t* state)
+{
+  action_callback_t* cb = entry.cb;
+  if (!cb->allow_procs && a && a->proc) return false;
+
+  if (auto dbc = entry.dbc)
+  {
+    // Same early outs as dbc_proc_callback_t::trigger(), without touching the callback
+    if (entry.ready && *entry.ready > a->sim->current_time())
+      return true;
+
+    if (entry.weapon && a->weapon != entry.weapon)
+      return true;
+
+    dbc->attempt_proc(a, state);
+  }
+  else
+  {
+    cb->trigger(a, state);
+  }
+
+  return true;
+}
+
+} // unnamed namespace
+
+void action_callback_t::trigger(const dispatch_list_t& list, action_t* a, action_state_t* state)
+{
+  if (a && !a->player->in_combat) return;
+
+  for (size_t w = 0; w < list.active.size(); w++)
+  {
+    uint64_t bits = list.active[w];
+    while (bits)
+    {
+      auto bit = lowest_bit(bits);
+      if (!dispatch(list.entries[w * 64 + bit], a, state))
+        return;
+
+      // Reread the mask, triggering a callback may (de)activate the ones after it
+      bits = list.active[w] & ~((uint64_t(2) << bit) - 1);
+    }
+  }
+}
+
 void action_callback_t::reset(const std::vector<action_callback_t*>& v)
 {
   std::size_t size = v.size();
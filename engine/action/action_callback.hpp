@@ -7,11 +7,16 @@
 
 #include "config.hpp"
 #include "util/generic.hpp"
+#include "util/timespan.hpp"
+#include <cstdint>
+#include <utility>
 #include <vector>
 
 struct action_t;
 struct action_state_t;
+struct dbc_proc_callback_t;
 struct player_t;
+struct weapon_t;
 
 struct action_callback_t : private noncopyable
 {
@@ -25,10 +30,45 @@ struct action_callback_t : private noncopyable
   virtual void trigger(action_t*, action_state_t*) = 0;
   virtual void reset() {}
   virtual void initialize() { }
-  virtual void activate() { active = true; }
-  virtual void deactivate() { active = false; }
+  virtual void activate() { set_active(true); }
+  virtual void deactivate() { set_active(false); }
+
+  // Dispatch table entry of a callback, see effect_callbacks_t::compile()
+  struct dispatch_t
+  {
+    action_callback_t* cb;
+    // Set if cb is a plain dbc_proc_callback_t. Such callbacks are filtered by the ready time of
+    // their cooldown and their weapon, captured below, and triggered without a virtual call.
+    dbc_proc_callback_t* dbc;
+    const timespan_t* ready;
+    const weapon_t* weapon;
+  };
+
+  // Dispatch table of a proc type and result, in registration order. The mask has a bit set for each
+  // active callback, and is kept up to date by activate() and deactivate(), so triggering the table
+  // only visits the active callbacks.
+  struct dispatch_list_t
+  {
+    std::vector<dispatch_t> entries;
+    std::vector<uint64_t> active;
+
+    void clear();
+
+    void add(action_callback_t* cb);
+
+    bool empty() const
+    { return entries.empty(); }
+  };
 
   static void trigger(const std::vector<action_callback_t*>& v, action_t* a, action_state_t* state);
 
+  static void trigger(const dispatch_list_t& list, action_t* a, action_state_t* state);
+
   static void reset(const std::vector<action_callback_t*>& v);
+
+private:
+  // Dispatch tables the callback is in, and its index in each of them
+  std::vector<std::pair<dispatch_list_t*, size_t>> dispatch_slots;
+
+  void set_active(bool a);
 };
\ No newline at end of file
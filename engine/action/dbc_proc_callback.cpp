@@ -65,6 +65,11 @@ void dbc_proc_callback_t::trigger( action_t* a, action_state_t* state )
   if ( weapon && ( !a->weapon || ( a->weapon && a->weapon != weapon ) ) )
     return;
 
+  attempt_proc( a, state );
+}
+
+void dbc_proc_callback_t::attempt_proc( action_t* a, action_state_t* state )
+{
   // Don't allow procs to proc itself
   if ( proc_action && state->action && state->action->internal_id == proc_action->internal_id )
   {
@@ -65,6 +65,10 @@ struct dbc_proc_callback_t : public action_callback_t
 
   void trigger(action_t* a, action_state_t* state) override;
 
+  // Rest of trigger() after the cooldown and weapon checks. Called directly by dispatch tables,
+  // which do these checks themselves.
+  void attempt_proc(action_t* a, action_state_t* state);
+
   // Determine target for the callback (action).
   virtual player_t* target(const action_state_t* state) const;
 
@@ -11,10 +11,12 @@
 #include "util/generic.hpp"
 #include "util/string_view.hpp"
 #include "util/format.hpp"
+#include "util/span.hpp"
 
 #include <string>
 #include <memory>
 #include <cstdint>
+#include <vector>
 
 struct action_t;
 struct action_state_t;
@@ -55,6 +57,13 @@ public:
   }
   void   refresh_duration(uint32_t state_flags = -1);
   void   reset();
+  // Track the dot for the next reset_dirty() of its target
+  void   mark_dirty();
+  // Whether the dot is in the state reset() leaves it in
+  bool   is_reset() const;
+  // Reset the dots marked dirty since the previous call, and clear the list. With
+  // sim_t::validate_buff_reset, dots in the list that are not marked are checked for being reset.
+  static void reset_dirty( sim_t* sim, util::span<dot_t* const> dots, std::vector<dot_t*>& dirty );
   void   cancel();
   void   trigger(timespan_t duration);
   void   decrement(int stacks);
@@ -102,6 +111,8 @@ public:
 
   void reschedule_tick();
 private:
+  bool dirty;
+
   void schedule_tick();
   void start(timespan_t duration);
   void refresh(timespan_t duration);
@@ -96,7 +96,9 @@ double heal_t::composite_player_critical_multiplier(const action_state_t*) const
 
 double heal_t::composite_versatility(const action_state_t* state) const
 {
-  return spell_base_t::composite_versatility(state) + player->cache.heal_versatility();
+  return cast_snapshot_value( STATE_VERSATILITY, [ this, state ] {
+    return spell_base_t::composite_versatility( state ) + player->cache.heal_versatility();
+  } );
 }
 
 result_amount_type heal_t::amount_type(const action_state_t* /* state */, bool periodic) const
@@ -228,7 +230,7 @@ void heal_t::assess_damage(result_amount_type heal_type, action_state_t* s)
     proc_types2 pt2 = s->impact_proc_type2();
     if ( pt != PROC1_INVALID && pt2 != PROC2_INVALID )
     {
-      action_callback_t::trigger( player->callbacks.procs[ pt ][ pt2 ], this, s );
+      player->callbacks.trigger( pt, pt2, this, s );
     }
   }
 
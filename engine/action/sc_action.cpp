@@ -294,6 +294,8 @@ action_t::action_t( action_e ty, util::string_view token, player_t* p, const spe
     usable_while_casting( false ),
     interrupt_auto_attack( true ),
     ignore_false_positive(),
+    cooldown_gated_ready( true ),
+    line_cooldown_gated_ready(),
     action_skill( p->base.skill ),
     direct_tick(),
     repeating(),
@@ -1370,17 +1372,17 @@ double action_t::composite_spell_power() const
 
 double action_t::composite_target_armor( player_t* target ) const
 {
-  return player->composite_player_target_armor( target );
+  return player->cache.player_target_armor( target );
 }
 
 double action_t::composite_target_crit_chance( player_t* target ) const
 {
-  return player->composite_player_target_crit_chance( target );
+  return player->cache.player_target_crit_chance( target );
 }
 
 double action_t::composite_target_multiplier(player_t* target) const
 {
-  return player->composite_player_target_multiplier(target, get_school());
+  return player->cache.player_target_multiplier( target, get_school() );
 }
 
 void action_t::consume_resource()
@@ -1539,6 +1541,8 @@ void action_t::execute()
     sim->cancel();
   }
 
+  player->invalidate_state();
+
   int num_targets = n_targets();
   if ( num_targets == 0 && target->is_sleeping() )
     return;
@@ -1582,6 +1586,13 @@ void action_t::execute()
     const int max_targets = as<int>( tl.size() );
     num_targets           = ( num_targets < 0 ) ? max_targets : std::min( max_targets, num_targets );
 
+    // Targets are still resolved one at a time, in order, so rng rolls and immediate impacts happen
+    // exactly as before. Only the target independent snapshot values are shared across targets.
+    // Sharing is disabled together with the player stat cache, which gives the reference results.
+    bool outer_cast_snapshot = cast_snapshot.active;
+    cast_snapshot.active = player->cache.active;
+    cast_snapshot.flags = 0;
+
     for ( int t = 0; t < num_targets; t++ )
     {
       action_state_t* s = get_state( pre_execute_state );
@@ -1608,6 +1619,9 @@ void action_t::execute()
 
       schedule_travel( s );
     }
+
+    cast_snapshot.active = outer_cast_snapshot;
+    cast_snapshot.flags = 0;
   }
   else  // single target
   {
@@ -1673,20 +1687,20 @@ void action_t::execute()
       // "On spell cast", only performed for foreground actions
       if ( ( pt2 = execute_state->cast_proc_type2() ) != PROC2_INVALID )
       {
-        action_callback_t::trigger( player->callbacks.procs[ pt ][ pt2 ], this, execute_state );
+        player->callbacks.trigger( pt, pt2, this, execute_state );
       }
 
       // "On an execute result"
       if ( ( pt2 = execute_state->execute_proc_type2() ) != PROC2_INVALID )
       {
-        action_callback_t::trigger( player->callbacks.procs[ pt ][ pt2 ], this, execute_state );
+        player->callbacks.trigger( pt, pt2, this, execute_state );
       }
 
       // "On interrupt cast result"
       if ( ( pt2 = execute_state->interrupt_proc_type2() ) != PROC2_INVALID )
       {
         if ( execute_state->target->debuffs.casting->check() )
-          action_callback_t::trigger( player->callbacks.procs[ pt ][ pt2 ], this, execute_state );
+          player->callbacks.trigger( pt, pt2, this, execute_state );
       }
     }
   }
@@ -1821,7 +1835,7 @@ void action_t::last_tick( dot_t* d )
 void action_t::assess_damage( result_amount_type type, action_state_t* s )
 {
   // Execute outbound damage assessor pipeline on the state object
-  player->assessor_out_damage.execute( type, s );
+  player->assessor_out_damage.execute( player, type, s );
 
   // TODO: Should part of this move to assessing, priority_iteration_damage for example?
   if ( s->result_raw > 0 || result_is_miss( s->result ) )
@@ -2272,6 +2286,27 @@ bool action_t::action_ready()
   return true;
 }
 
+// Fast pre-check used by the APL to skip lines that cannot be ready. Mirrors the cooldown checks
+// done first in action_t::ready() (and the line cooldown check of action_ready()), so a false
+// result here never changes the outcome of the full readiness check.
+bool action_t::cooldowns_ready() const
+{
+  if ( cooldown_gated_ready )
+  {
+    if ( !cooldown->is_ready() )
+      return false;
+
+    if ( internal_cooldown->down() )
+      return false;
+  }
+
+  if ( line_cooldown_gated_ready && action_skill == 1 && player->current.skill_debuff == 0 &&
+       line_cooldown->down() )
+    return false;
+
+  return true;
+}
+
 // Properties that govern if the spell itself is executable, without considering any kind of user
 // options
 bool action_t::ready()
@@ -2583,6 +2618,13 @@ void action_t::init_finished()
     player->dynamic_target_action_list.insert( this );
   }
 
+  // The line cooldown is checked after ready() and target selection in action_ready(). It can only be
+  // checked ahead of them if neither has side effects, i.e., no target cycling, no target_if, and no
+  // starvation tracking in ready().
+  line_cooldown_gated_ready = cooldown_gated_ready && line_cooldown->duration > 0_ms &&
+                              target_if_mode == TARGET_IF_NONE && !option.cycle_targets &&
+                              !option.cycle_players && !option.target_number && !starved_proc;
+
   if ( !option.if_expr_str.empty() )
   {
     if_expr = expr_t::parse( this, option.if_expr_str, sim->optimize_expressions );
@@ -3731,16 +3773,22 @@ void action_t::snapshot_internal( action_state_t* state, unsigned flags, result_
   state->result_type = rt;
 
   if ( flags & STATE_CRIT )
-    state->crit_chance = composite_crit_chance() * composite_crit_chance_multiplier();
+    state->crit_chance = cast_snapshot_value( STATE_CRIT, [ this ] {
+      return composite_crit_chance() * composite_crit_chance_multiplier();
+    } );
 
   if ( flags & STATE_HASTE )
-    state->haste = composite_haste();
+    state->haste = cast_snapshot_value( STATE_HASTE, [ this ] { return composite_haste(); } );
 
   if ( flags & STATE_AP )
-    state->attack_power = composite_attack_power() * player->composite_attack_power_multiplier();
+    state->attack_power = cast_snapshot_value( STATE_AP, [ this ] {
+      return composite_attack_power() * player->composite_attack_power_multiplier();
+    } );
 
   if ( flags & STATE_SP )
-    state->spell_power = composite_spell_power() * player->composite_spell_power_multiplier();
+    state->spell_power = cast_snapshot_value( STATE_SP, [ this ] {
+      return composite_spell_power() * player->composite_spell_power_multiplier();
+    } );
 
   if ( flags & STATE_VERSATILITY )
     state->versatility = composite_versatility( state );
@@ -4221,47 +4269,127 @@ double action_t::composite_total_corruption() const
   return player->composite_total_corruption();
 }
 
-double action_t::composite_da_multiplier(const action_state_t*) const
+// Position of a STATE_HASTE through STATE_MUL_PERSISTENT flag in action_t::cast_snapshot_t::values
+static unsigned cast_snapshot_slot( unsigned flag )
 {
-  double base_multiplier = action_multiplier();
-  double direct_multiplier = action_da_multiplier();
-  double player_school_multiplier = 0.0;
-  double tmp;
+  unsigned slot = 0;
+  while ( flag >>= 1 )
+    ++slot;
 
-  for (auto base_school : base_schools)
+  assert( slot < 8 );
+  return slot;
+}
+
+uint64_t action_t::cache_version() const
+{
+  return player->state_version() + ( target ? target->state_version() : 0 );
+}
+
+const double* action_t::cast_snapshot_find( unsigned flag ) const
+{
+  auto version = cache_version();
+  if ( cast_snapshot.epoch != version || cast_snapshot.target != target )
   {
-    tmp = player->cache.player_multiplier(base_school);
-    if (tmp > player_school_multiplier) player_school_multiplier = tmp;
+    cast_snapshot.flags  = 0;
+    cast_snapshot.epoch  = version;
+    cast_snapshot.target = target;
   }
 
-  return base_multiplier * direct_multiplier * player_school_multiplier *
-    player->composite_player_dd_multiplier(get_school(), this);
+  return ( cast_snapshot.flags & flag ) ? &cast_snapshot.values[ cast_snapshot_slot( flag ) ] : nullptr;
 }
 
-/// Normal ticking modifiers that are updated every tick
+void action_t::cast_snapshot_store( unsigned flag, double value ) const
+{
+  // Computing the value may change actor state (e.g., by expiring a buff), in which case it cannot
+  // be reused.
+  if ( cast_snapshot.epoch == cache_version() )
+  {
+    cast_snapshot.values[ cast_snapshot_slot( flag ) ] = value;
+    cast_snapshot.flags |= flag;
+  }
+  else
+  {
+    cast_snapshot.flags = 0;
+  }
+}
 
-double action_t::composite_ta_multiplier(const action_state_t*) const
+double action_t::cached_multiplier( unsigned flag, double multiplier_cache_t::*value,
+                                     double ( action_t::*fn )() const ) const
 {
-  double base_multiplier = action_multiplier();
-  double tick_multiplier = action_ta_multiplier();
-  double player_school_multiplier = 0.0;
-  double tmp;
+  if ( !player->cache.active )
+    return ( this->*fn )();
 
-  for (auto base_school : base_schools)
+  auto& c = multiplier_cache;
+  auto version = cache_version();
+  if ( c.epoch != version || c.time != sim->current_time() || c.target != target )
   {
-    tmp = player->cache.player_multiplier(base_school);
-    if (tmp > player_school_multiplier) player_school_multiplier = tmp;
+    c.valid  = 0;
+    c.epoch  = version;
+    c.time   = sim->current_time();
+    c.target = target;
   }
 
-  return base_multiplier * tick_multiplier * player_school_multiplier *
-    player->composite_player_td_multiplier(get_school(), this);
+  if ( !( c.valid & flag ) )
+  {
+    c.*value = ( this->*fn )();
+    // Computing the multiplier may change actor state (e.g., by expiring a buff), in which case it
+    // cannot be reused.
+    if ( c.epoch == cache_version() )
+      c.valid |= flag;
+    else
+      c.valid = 0;
+  }
+
+  return c.*value;
+}
+
+double action_t::composite_da_multiplier(const action_state_t*) const
+{
+  return cast_snapshot_value( STATE_MUL_DA, [ this ] {
+    double base_multiplier = cached_multiplier( 1U, &multiplier_cache_t::action, &action_t::action_multiplier );
+    double direct_multiplier = cached_multiplier( 2U, &multiplier_cache_t::da, &action_t::action_da_multiplier );
+    double player_school_multiplier = 0.0;
+    double tmp;
+
+    for (auto base_school : base_schools)
+    {
+      tmp = player->cache.player_multiplier(base_school);
+      if (tmp > player_school_multiplier) player_school_multiplier = tmp;
+    }
+
+    return base_multiplier * direct_multiplier * player_school_multiplier *
+      player->composite_player_dd_multiplier(get_school(), this);
+  } );
+}
+
+/// Normal ticking modifiers that are updated every tick
+
+double action_t::composite_ta_multiplier(const action_state_t*) const
+{
+  return cast_snapshot_value( STATE_MUL_TA, [ this ] {
+    double base_multiplier = cached_multiplier( 1U, &multiplier_cache_t::action, &action_t::action_multiplier );
+    double tick_multiplier = cached_multiplier( 4U, &multiplier_cache_t::ta, &action_t::action_ta_multiplier );
+    double player_school_multiplier = 0.0;
+    double tmp;
+
+    for (auto base_school : base_schools)
+    {
+      tmp = player->cache.player_multiplier(base_school);
+      if (tmp > player_school_multiplier) player_school_multiplier = tmp;
+    }
+
+    return base_multiplier * tick_multiplier * player_school_multiplier *
+      player->composite_player_td_multiplier(get_school(), this);
+  } );
 }
 
 /// Persistent modifiers that are snapshot at the start of the spell cast
 
 double action_t::composite_persistent_multiplier(const action_state_t*) const
 {
-  return player->composite_persistent_multiplier(get_school());
+  return cast_snapshot_value( STATE_MUL_PERSISTENT, [ this ] {
+    return player->composite_persistent_multiplier( get_school() );
+  } );
 }
 
 double action_t::composite_target_mitigation(player_t* t, school_e s) const
@@ -144,6 +144,18 @@ public:
   /// Used for actions that will do awful things to the sim when a "false positive" skill roll happens.
   bool ignore_false_positive;
 
+  /**
+   * @brief Readiness of the action requires its own cooldown and internal cooldown to be ready.
+   *
+   * Allows player_t::select_action to skip the APL line without calling action_ready() while the
+   * cooldowns are down. Disable for actions whose ready() does not go through action_t::ready().
+   */
+  bool cooldown_gated_ready;
+
+  /// Line cooldown can be checked ahead of action_ready() without changing its outcome. Set up
+  /// automatically by action_t::init_finished
+  bool line_cooldown_gated_ready;
+
   /// Skill is now done per ability, with the default being set to the player option.
   double action_skill;
 
@@ -528,6 +540,44 @@ private:
   std::vector<std::unique_ptr<option_t>> options;
   action_state_t* state_cache;
   std::vector<travel_event_t*> travel_events;
+
+  /**
+   * Target independent snapshot values of an aoe execute, computed for the first target and reused
+   * for the rest as long as cache_version() and the action target do not change (e.g., through an
+   * immediate impact triggering a buff on the player, or damaging the action target). Values are
+   * keyed by their snapshot flag (STATE_HASTE through STATE_MUL_PERSISTENT), see
+   * cast_snapshot_value().
+   */
+  struct cast_snapshot_t
+  {
+    bool active = false;
+    unsigned flags = 0;
+    uint64_t epoch = 0;
+    const player_t* target = nullptr;
+    double values[ 8 ] = {};
+  } mutable cast_snapshot;
+
+  /// State version of the player and the action target, see player_t::state_version()
+  uint64_t cache_version() const;
+
+  const double* cast_snapshot_find( unsigned flag ) const;
+  void cast_snapshot_store( unsigned flag, double value ) const;
+
+  /**
+   * Results of the action_multiplier(), action_da_multiplier() and action_ta_multiplier() override
+   * chains, valid while cache_version(), the current time and the action target do not change.
+   * Disabled together with the player stat cache.
+   */
+  struct multiplier_cache_t
+  {
+    unsigned valid = 0;
+    uint64_t epoch = 0;
+    timespan_t time = timespan_t::zero();
+    const player_t* target = nullptr;
+    double action = 0, da = 0, ta = 0;
+  } mutable multiplier_cache;
+
+  double cached_multiplier( unsigned flag, double multiplier_cache_t::*value, double ( action_t::*fn )() const ) const;
 public:
   action_t( action_e type, util::string_view token, player_t* p );
   action_t( action_e type, util::string_view token, player_t* p, const spell_data_t* s );
@@ -538,6 +588,26 @@ public:
 
   void add_option( std::unique_ptr<option_t> new_option );
 
+  /**
+   * Value of a target independent snapshot computation, computed once and shared by all targets of
+   * an aoe execute, and computed on every call otherwise. Used by the engine implementations of the
+   * snapshot composites, so overrides that add target dependent parts (e.g., from s->target) still
+   * run for every target.
+   */
+  template <typename F>
+  double cast_snapshot_value( snapshot_state_e flag, F&& compute ) const
+  {
+    if ( !cast_snapshot.active )
+      return compute();
+
+    if ( const double* value = cast_snapshot_find( flag ) )
+      return *value;
+
+    double value = compute();
+    cast_snapshot_store( flag, value );
+    return value;
+  }
+
   void   check_spec( specialization_e );
 
   void   check_spell( const spell_data_t* );
@@ -910,6 +980,10 @@ public:
   /// Is the action ready, as a combination of ability characteristics and user input? Main
   /// ntry-point when selecting something to do for an actor.
   virtual bool action_ready();
+
+  /// Cheap, side effect free check if the action can possibly be ready based on its cooldowns. A
+  /// false result guarantees action_ready() would also fail.
+  bool cooldowns_ready() const;
   /// Select a target to execute on
   virtual bool select_target();
   /// Target readiness state checking
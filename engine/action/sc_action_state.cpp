@@ -6,6 +6,7 @@
 #include "action/sc_action_state.hpp"
 #include "action/sc_action.hpp"
 #include "player/sc_player.hpp"
+#include <cstring>
 #include <sstream>
 
 action_state_t* action_t::get_state( const action_state_t* other )
@@ -19,6 +20,7 @@ action_state_t* action_t::get_state( const action_state_t* other )
   }
   else
   {
+    action_state_pool_t::scope_t scope( player->action_state_pool );
     s = new_state();
   }
 
@@ -76,40 +78,12 @@ void action_state_t::copy_state( const action_state_t* o )
   }
 #endif
 
-  target = o->target;
+  // The plain data members are copied in bulk, in two ranges to leave block_result as is
+  std::memcpy( &target, &o->target,
+               reinterpret_cast<const char*>( &result + 1 ) - reinterpret_cast<const char*>( &target ) );
+  std::memcpy( &result_raw, &o->result_raw,
+               reinterpret_cast<const char*>( &target_armor + 1 ) - reinterpret_cast<const char*>( &result_raw ) );
   assert( target );
-  n_targets          = o->n_targets;
-  chain_target       = o->chain_target;
-  original_x         = o->original_x;
-  original_y         = o->original_y;
-  result_type        = o->result_type;
-  result             = o->result;
-  result_raw         = o->result_raw;
-  result_total       = o->result_total;
-  result_mitigated   = o->result_mitigated;
-  result_absorbed    = o->result_absorbed;
-  result_crit_bonus  = o->result_crit_bonus;
-  result_amount      = o->result_amount;
-  blocked_amount     = o->blocked_amount;
-  self_absorb_amount = o->self_absorb_amount;
-  haste              = o->haste;
-  crit_chance        = o->crit_chance;
-  target_crit_chance = o->target_crit_chance;
-  attack_power       = o->attack_power;
-  spell_power        = o->spell_power;
-
-  versatility           = o->versatility;
-  da_multiplier         = o->da_multiplier;
-  ta_multiplier         = o->ta_multiplier;
-  persistent_multiplier = o->persistent_multiplier;
-  pet_multiplier        = o->pet_multiplier;
-
-  target_da_multiplier = o->target_da_multiplier;
-  target_ta_multiplier = o->target_ta_multiplier;
-
-  target_mitigation_da_multiplier = o->target_mitigation_da_multiplier;
-  target_mitigation_ta_multiplier = o->target_mitigation_ta_multiplier;
-  target_armor                    = o->target_armor;
 }
 
 action_state_t::action_state_t( action_t* a, player_t* t )
@@ -259,6 +233,78 @@ void travel_event_t::execute()
   action->remove_travel_event( this );
 }
 
+namespace
+{
+// Arena used by action_state_t::operator new, set by action_state_pool_t::scope_t
+thread_local action_state_pool_t* current_state_pool = nullptr;
+
+// Every state allocation is prefixed with a header telling where the memory came from
+constexpr std::size_t STATE_HEADER_SIZE = alignof( std::max_align_t );
+enum state_memory_e : uint8_t { STATE_MEMORY_HEAP, STATE_MEMORY_POOL };
+}  // namespace
+
+void* action_state_pool_t::allocate( std::size_t size )
+{
+  size = ( size + STATE_HEADER_SIZE - 1 ) & ~( STATE_HEADER_SIZE - 1 );
+
+  if ( size > PAGE_SIZE )
+  {
+    pages.emplace_back( new uint8_t[ size ] );
+    return pages.back().get();
+  }
+
+  if ( size > remaining )
+  {
+    pages.emplace_back( new uint8_t[ PAGE_SIZE ] );
+    current   = pages.back().get();
+    remaining = PAGE_SIZE;
+  }
+
+  void* p = current;
+  current += size;
+  remaining -= size;
+
+  return p;
+}
+
+action_state_pool_t::scope_t::scope_t( action_state_pool_t& pool ) : previous( current_state_pool )
+{
+  current_state_pool = &pool;
+}
+
+action_state_pool_t::scope_t::~scope_t()
+{
+  current_state_pool = previous;
+}
+
+void* action_state_t::operator new( std::size_t size )
+{
+  uint8_t* p;
+  if ( current_state_pool )
+  {
+    p    = static_cast<uint8_t*>( current_state_pool->allocate( STATE_HEADER_SIZE + size ) );
+    p[0] = STATE_MEMORY_POOL;
+  }
+  else
+  {
+    p    = static_cast<uint8_t*>( ::operator new( STATE_HEADER_SIZE + size ) );
+    p[0] = STATE_MEMORY_HEAP;
+  }
+
+  return p + STATE_HEADER_SIZE;
+}
+
+// Pooled memory is released with the arena
+void action_state_t::operator delete( void* ptr )
+{
+  if ( !ptr )
+    return;
+
+  auto p = static_cast<uint8_t*>( ptr ) - STATE_HEADER_SIZE;
+  if ( p[0] == STATE_MEMORY_HEAP )
+    ::operator delete( p );
+}
+
 void action_state_t::release( action_state_t*& s )
 {
   assert( s );
@@ -6,7 +6,10 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <string>
+#include <vector>
 #include <iosfwd>
 #include "config.hpp"
 #include "util/generic.hpp"
@@ -17,10 +20,41 @@
 struct action_t;
 struct player_t;
 
+/**
+ * Per-actor arena for action states. States created through action_t::get_state() are allocated
+ * from contiguous pages of the arena of the action's actor instead of individually from the heap.
+ * States are recycled per action (action_t::release_state()), the arena memory is only returned
+ * when the actor is destroyed.
+ */
+class action_state_pool_t : private noncopyable
+{
+  static constexpr std::size_t PAGE_SIZE = 16384;
+
+  std::vector<std::unique_ptr<uint8_t[]>> pages;
+  uint8_t*    current;
+  std::size_t remaining;
+
+public:
+  action_state_pool_t() : current( nullptr ), remaining( 0 ) { }
+
+  void* allocate( std::size_t size );
+
+  // Allocates action states created in the scope from the given arena
+  class scope_t : private noncopyable
+  {
+    action_state_pool_t* previous;
+
+  public:
+    explicit scope_t( action_state_pool_t& pool );
+    ~scope_t();
+  };
+};
+
 struct action_state_t : private noncopyable
 {
   action_state_t* next;
-  // Source action, target actor
+  // Source action, target actor. copy_state() copies the members from target to result and from
+  // result_raw to target_armor in bulk, so these need to stay plain data declared in this order.
   action_t*       action;
   player_t*       target;
   // Execution attributes
@@ -62,6 +96,9 @@ struct action_state_t : private noncopyable
   static void release( action_state_t*& s );
   static std::string flags_to_str( unsigned flags );
 
+  static void* operator new( std::size_t size );
+  static void  operator delete( void* p );
+
   action_state_t( action_t*, player_t* );
   virtual ~action_state_t() {}
 
@@ -200,7 +200,9 @@ double attack_t::composite_expertise() const
 
 double attack_t::composite_versatility(const action_state_t* state) const
 {
-  return action_t::composite_versatility(state) + player->cache.damage_versatility();
+  return cast_snapshot_value( STATE_VERSATILITY, [ this, state ] {
+    return action_t::composite_versatility( state ) + player->cache.damage_versatility();
+  } );
 }
 
 void attack_t::attack_table_t::build_table( double miss_chance,
@@ -65,8 +65,10 @@ dot_t::dot_t( util::string_view n, player_t* t, player_t* s )
     state(),
     current_tick(),
     max_stack(),
-    name_str( n )
+    name_str( n ),
+    dirty( false )
 {
+  mark_dirty();
 }
 
 // dot_t::cancel ============================================================
@@ -162,7 +164,11 @@ void dot_t::refresh_duration( uint32_t state_flags )
 void dot_t::reset()
 {
   if ( ticking )
+  {
     source->remove_active_dot( state->action->internal_id );
+    target->invalidate_state();
+    source->invalidate_state();
+  }
 
   event_t::cancel( tick_event );
   event_t::cancel( end_event );
@@ -177,6 +183,44 @@ void dot_t::reset()
     action_state_t::release( state );
 }
 
+void dot_t::mark_dirty()
+{
+  if ( !dirty )
+  {
+    dirty = true;
+    target->dirty_dot_list.push_back( this );
+  }
+}
+
+bool dot_t::is_reset() const
+{
+  return !ticking && !tick_event && !end_event && tick_time == 0_ms && current_tick == 0 && stack == 0 &&
+         extra_time == 0_ms && current_duration == timespan_t::min() && !state;
+}
+
+void dot_t::reset_dirty( sim_t* sim, util::span<dot_t* const> dots, std::vector<dot_t*>& dirty )
+{
+  if ( sim->validate_buff_reset )
+  {
+    for ( auto dot : dots )
+    {
+      if ( !dot->dirty && !dot->is_reset() )
+      {
+        sim->error( "{} changed state without being marked dirty, and was not reset.", *dot );
+        dot->mark_dirty();
+      }
+    }
+  }
+
+  for ( auto dot : dirty )
+  {
+    dot->reset();
+    dot->dirty = false;
+  }
+
+  dirty.clear();
+}
+
 /* Trigger a dot with given duration.
  * Main function to start/refresh a dot
  */
@@ -184,6 +228,8 @@ void dot_t::trigger( timespan_t duration )
 {
   assert( duration > 0_ms && "Dot Trigger with duration <= 0 seconds." );
 
+  mark_dirty();
+
   current_tick = 0;
   extra_time   = 0_ms;
 
@@ -242,6 +288,7 @@ void dot_t::copy( player_t* other_target, dot_copy_e copy_type ) const
     return;
 
   dot_t* other_dot = current_action->get_dot( other_target );
+  other_dot->mark_dirty();
   // Copied dot, with the DOT_COPY_START method cancels the ongoing dot on the
   // target, and then starts a fresh dot on it with the source dot's (copied)
   // state
@@ -838,6 +885,8 @@ void dot_t::start( timespan_t duration )
   check_tick_zero( true );
 
   source->add_active_dot( current_action->internal_id );
+  target->invalidate_state();
+  source->invalidate_state();
 }
 
 /* Precondition: ticking == true
@@ -850,6 +899,8 @@ void dot_t::refresh( timespan_t duration )
   if ( stack < max_stack )
     stack++;
 
+  target->invalidate_state();
+
   assert( end_event && "Dot is ticking but has no end event." );
   timespan_t remaining_duration = end_event->remains();
   if ( current_duration > remaining_duration )
@@ -237,7 +237,9 @@ double spell_t::composite_hit() const
 
 double spell_t::composite_versatility(const action_state_t* state) const
 {
-  return spell_base_t::composite_versatility(state) + player->cache.damage_versatility();
+  return cast_snapshot_value( STATE_VERSATILITY, [ this, state ] {
+    return spell_base_t::composite_versatility( state ) + player->cache.damage_versatility();
+  } );
 }
 
 double spell_t::composite_target_multiplier(player_t* target) const
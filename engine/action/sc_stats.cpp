@@ -15,6 +15,7 @@
 stats_t::stats_t( util::string_view n, player_t* p ) :
   sim( *( p -> sim ) ),
   name_str( n ),
+  name_symbol( util::symbol_t::intern( n ) ),
   player( p ),
   parent( nullptr ),
   school( SCHOOL_NONE ),
@@ -141,20 +141,19 @@ variable_t::variable_t(player_t* player, util::string_view options_str) :
   }
 
   // Find the variable
-  for (auto& elem : player->variables)
-  {
-    if (util::str_compare_ci(elem->name_, name_str))
-    {
-      var = elem;
-      break;
-    }
-  }
+  var = player->find_variable(name_str);
 
   if (!var)
   {
     player->variables.push_back(new action_variable_t(name_str, default_));
     var = player->variables.back();
   }
+
+  // Printing consumes the value of the variable
+  if (operation == OPERATION_PRINT)
+  {
+    var->add_reader();
+  }
 }
 
 void variable_t::init_finished()
@@ -215,6 +214,22 @@ void variable_t::reset()
   }
 }
 
+// Lazy evaluation of variables. The value of a variable nobody reads (through a variable.<name>
+// expression, a print operation or code that registered itself as a reader, see
+// player_t::find_variable()) cannot influence the simulation, so the variable action is never
+// evaluated. The rest of the readiness check is skipped only when it does not draw random
+// numbers, so that the random number stream of the actor stays identical.
+
+bool variable_t::action_ready()
+{
+  if (sim->optimize_expressions && !var->is_read() && action_skill == 1 && player->current.skill_debuff == 0)
+  {
+    return false;
+  }
+
+  return action_t::action_ready();
+}
+
 // A variable action is constant if
 // 1) The operation is not SETIF and the value expression is constant
 // 2) The operation is SETIF and both the condition expression and the value (or value expression)
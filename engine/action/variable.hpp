@@ -31,6 +31,9 @@ struct variable_t : public action_t
 
   void reset() override;
 
+  // Variable actions of variables that are not read by anything are never ready
+  bool action_ready() override;
+
   // A variable action is constant if
   // 1) The operation is not SETIF and the value expression is constant
   // 2) The operation is SETIF and both the condition expression and the value (or value expression)
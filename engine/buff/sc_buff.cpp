@@ -483,6 +483,7 @@ buff_t::buff_t( sim_t* sim, player_t* target, player_t* source, util::string_vie
     player( target ),
     item( item ),
     name_str( name ),
+    name_symbol( util::symbol_t::intern( name ) ),
     s_data( spell_data ),
     s_data_reporting( spell_data_t::nil() ),
     source( source ),
@@ -549,7 +550,8 @@ buff_t::buff_t( sim_t* sim, player_t* target, player_t* source, util::string_vie
     start_intervals(),
     trigger_intervals(),
     duration_lengths(),
-    change_regen_rate( false )
+    change_regen_rate( false ),
+    dirty( false )
 {
   if ( source )  // Player Buffs
   {
@@ -562,6 +564,9 @@ buff_t::buff_t( sim_t* sim, player_t* target, player_t* source, util::string_vie
     cooldown = sim->get_cooldown( "buff_" + name_str );
   }
 
+  // Every buff is reset before the first iteration
+  mark_dirty();
+
   // Set Buff duration
   set_duration( base_buff_duration );
 
@@ -1692,6 +1697,8 @@ bool buff_t::trigger( int stacks, double value, double chance, timespan_t durati
       return false;
   }
 
+  mark_dirty();
+
   // In-game, procs that happen "close to eachother" are usually delayed into the same time slot. We roughly model this
   // by allowing procs that happen during the buff's already existing delay period to trigger at the same time as the
   // first delayed proc will happen.
@@ -1727,6 +1734,8 @@ bool buff_t::trigger( int stacks, double value, double chance, timespan_t durati
 
 void buff_t::execute( int stacks, double value, timespan_t duration )
 {
+  mark_dirty();
+
   if ( value == DEFAULT_VALUE() && default_value != DEFAULT_VALUE() )
     value = default_value;
 
@@ -1773,6 +1782,8 @@ void buff_t::execute( int stacks, double value, timespan_t duration )
 
 void buff_t::increment( int stacks, double value, timespan_t duration )
 {
+  mark_dirty();
+
   if ( overridden )
     return;
 
@@ -1794,6 +1805,8 @@ void buff_t::increment( int stacks, double value, timespan_t duration )
 
 void buff_t::decrement( int stacks, double value )
 {
+  mark_dirty();
+
   if ( overridden )
     return;
 
@@ -1905,6 +1918,8 @@ void buff_t::extend_duration_or_trigger( timespan_t duration, player_t* p )
 
 void buff_t::start( int stacks, double value, timespan_t duration )
 {
+  mark_dirty();
+
   if ( _max_stack == 0 )
     return;
 
@@ -2001,6 +2016,8 @@ void buff_t::start( int stacks, double value, timespan_t duration )
 
 void buff_t::refresh( int stacks, double value, timespan_t duration )
 {
+  mark_dirty();
+
   if ( _max_stack == 0 )
     return;
 
@@ -2084,6 +2101,8 @@ void buff_t::refresh( int stacks, double value, timespan_t duration )
 
 void buff_t::bump( int stacks, double value )
 {
+  mark_dirty();
+
   if ( _max_stack == 0 )
     return;
 
@@ -2170,7 +2189,8 @@ void buff_t::bump( int stacks, double value )
             timespan_t next_react = sim->current_time() + total_reaction_time;
             if ( next_react > stack_react_ready_triggers[ i ]->occurs() )
             {
-              stack_react_ready_triggers[ i ]->reschedule( next_react );
+              // reschedule() takes the new delay from now, not an absolute time
+              stack_react_ready_triggers[ i ]->reschedule( total_reaction_time );
             }
             else if ( next_react < stack_react_ready_triggers[ i ]->occurs() )
             {
@@ -2215,6 +2235,8 @@ void buff_t::bump( int stacks, double value )
 
 void buff_t::override_buff( int stacks, double value )
 {
+  mark_dirty();
+
   if ( _max_stack == 0 )
     return;
 
@@ -2243,6 +2265,8 @@ void buff_t::expire( timespan_t delay )
     return;
   }
 
+  mark_dirty();
+
   if ( delay > timespan_t::zero() )  // Expiration Delay
   {
     if ( !expiration_delay )  // Don't reschedule already existing expiration delay
@@ -2411,6 +2435,67 @@ void buff_t::reset()
   last_stack_change = timespan_t::min();
 }
 
+void buff_t::mark_dirty()
+{
+  if ( player )
+    player->invalidate_state();
+  else
+    sim->actor_state_epoch++;
+
+  if ( !dirty )
+  {
+    add_dirty();
+  }
+}
+
+void buff_t::add_dirty()
+{
+  dirty = true;
+  if ( source )
+  {
+    player->dirty_buff_list.push_back( this );
+  }
+  else
+  {
+    sim->dirty_buff_list.push_back( this );
+  }
+}
+
+bool buff_t::is_reset() const
+{
+  return current_stack == 0 && expiration.empty() && !delay && !expiration_delay && !tick_event &&
+         !range::any_of( stack_react_ready_triggers, []( const event_t* e ) { return e != nullptr; } ) &&
+         last_start == timespan_t::min() && last_trigger == timespan_t::min() &&
+         last_expire == timespan_t::min() && last_stack_change == timespan_t::min();
+}
+
+void buff_t::reset_dirty( sim_t* sim, util::span<buff_t* const> buffs, std::vector<buff_t*>& dirty )
+{
+  if ( sim->validate_buff_reset )
+  {
+    for ( auto buff : buffs )
+    {
+      if ( !buff->dirty && !buff->is_reset() )
+      {
+        sim->error( "{} changed state without being marked dirty, and was not reset.", *buff );
+        buff->mark_dirty();
+      }
+    }
+  }
+
+  // Resetting a buff may change the state of others (e.g., through stack change callbacks), adding
+  // them to the end of the list. A buff stays marked while it is reset, so it is not added again by
+  // its own expiration.
+  for ( size_t i = 0; i < dirty.size(); ++i )
+  {
+    auto buff = dirty[ i ];
+    buff->reset();
+    buff->dirty = false;
+  }
+
+  dirty.clear();
+}
+
 void buff_t::merge( const buff_t& other )
 {
   start_intervals.merge( other.start_intervals );
@@ -2578,12 +2663,13 @@ void buff_t::invalidate_cache()
 
 buff_t* buff_t::find( sim_t* s, util::string_view name )
 {
-  return find( s->buff_list, name );
+  return s->buff_index.find( s->buff_list, name );
 }
 
 buff_t* buff_t::find( player_t* p, util::string_view name, player_t* source )
 {
-  return find( p->buff_list, name, source );
+  return p->buff_index.find( p->buff_list, name,
+                             [ source ]( const buff_t* b ) { return !source || source == b->source; } );
 }
 
 util::string_view buff_t::source_name() const
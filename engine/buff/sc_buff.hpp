@@ -19,6 +19,7 @@
 #include "util/sample_data.hpp"
 #include "util/span.hpp"
 #include "util/string_view.hpp"
+#include "util/symbol.hpp"
 #include "util/timeline.hpp"
 #include "sim/uptime.hpp"
 #include "util/format.hpp"
@@ -58,6 +59,7 @@ public:
   player_t* const player;
   const item_t* const item;
   const std::string name_str;
+  const util::symbol_t name_symbol;
   const spell_data_t* s_data;
   const spell_data_t* s_data_reporting;
   player_t* const source;
@@ -268,6 +270,9 @@ public:
   virtual void expire_override( int /* expiration_stacks */, timespan_t /* remaining_duration */ ) {}
   virtual void predict();
   virtual void reset();
+  // Whether the buff is in the state reset() leaves it in. Buffs that reset custom state in reset()
+  // check it here too, for the validate_buff_reset option.
+  virtual bool is_reset() const;
   virtual void aura_gain();
   virtual void aura_loss();
   virtual void merge( const buff_t& other_buff );
@@ -310,6 +315,15 @@ public:
 
   bool change_regen_rate;
 
+  // Record that the buff state changed in the current iteration, so the buff is reset at the start
+  // of the next one. The buff_t methods that change the buff state call this, buffs with custom
+  // state changed outside of them need to call it too.
+  void mark_dirty();
+
+  // Reset the dirty buffs of an actor (or the sim). With sim_t::validate_buff_reset, also verify
+  // that the rest of the buffs are still in their reset state.
+  static void reset_dirty( sim_t*, util::span<buff_t* const> buffs, std::vector<buff_t*>& dirty );
+
   buff_t* set_chance( double chance );
   buff_t* set_duration( timespan_t duration );
   buff_t* modify_duration( timespan_t duration );
@@ -363,6 +377,9 @@ public:
 
   friend void format_to( const buff_t&, fmt::format_context::iterator );
 private:
+  bool dirty;
+
+  void add_dirty();
   void update_trigger_calculations();
   void adjust_haste();
   void init_haste_type();
@@ -1597,6 +1597,9 @@ struct blessing_of_sacrifice_t : public buff_t
     source = nullptr;
     source_health_pool = 0.0;
   }
+
+  bool is_reset() const override
+  { return buff_t::is_reset() && source == nullptr && source_health_pool == 0.0; }
 };
 
 } // end namespace buffs
@@ -708,6 +708,9 @@ namespace buffs {
       accumulated_damage = 0.0;
     }
 
+    bool is_reset() const override
+    { return buff_t::is_reset() && accumulated_damage == 0.0; }
+
     void expire_override( int stacks, timespan_t duration ) override
     {
       buff_t::expire_override( stacks, duration );
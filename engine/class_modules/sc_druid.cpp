@@ -5366,6 +5366,9 @@ struct moon_proxy_t : public druid_spell_t
     new_moon = new new_moon_t( p, opt );
     half_moon = new half_moon_t( p, opt );
     full_moon = new full_moon_t( p, opt );
+
+    // Readiness is delegated to the moon of the current stage
+    cooldown_gated_ready = false;
   }
 
   void schedule_execute( action_state_t* s ) override
@@ -5448,6 +5451,9 @@ struct thrash_proxy_t : public druid_spell_t
     // are important for the "ticks_gained_on_refresh" expression to work
     dot_duration   = thrash_cat->dot_duration;
     base_tick_time = thrash_cat->base_tick_time;
+
+    // Readiness is delegated to the form-specific version
+    cooldown_gated_ready = false;
   }
 
   timespan_t gcd() const override
@@ -5529,6 +5535,9 @@ struct swipe_proxy_t : public druid_spell_t
   {
     swipe_cat  = new cat_attacks::swipe_cat_t( p, options_str );
     swipe_bear = new bear_attacks::swipe_bear_t( p, options_str );
+
+    // Readiness is delegated to the form-specific version
+    cooldown_gated_ready = false;
   }
 
   timespan_t gcd() const override
@@ -1086,6 +1086,9 @@ struct combustion_t final : public buff_t
     buff_t::reset();
     current_amount = 0.0;
   }
+
+  bool is_reset() const override
+  { return buff_t::is_reset() && current_amount == 0.0; }
 };
 
 // TODO: Verify what happens when Expanded Potential is triggered and
@@ -1167,6 +1170,9 @@ struct incanters_flow_t final : public buff_t
     reverse = false;
   }
 
+  bool is_reset() const override
+  { return buff_t::is_reset() && !reverse; }
+
   void bump( int stacks, double value ) override
   {
     if ( at_max_stacks() )
@@ -1292,6 +1298,9 @@ struct mirrors_of_torment_t final : public buff_t
     successful_triggers = 0;
   }
 
+  bool is_reset() const override
+  { return buff_t::is_reset() && successful_triggers == 0; }
+
   bool freeze_stacks() override
   {
     // Stacks are handled manually by the tick callback.
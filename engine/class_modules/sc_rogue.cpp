@@ -4117,6 +4117,8 @@ struct stealth_t : public rogue_spell_t
     rogue_spell_t( name, p, p->find_class_spell( "Stealth" ), options_str )
   {
     harmful = false;
+    // ready() does not check the cooldown
+    cooldown_gated_ready = false;
   }
 
   void execute() override
@@ -4317,6 +4319,8 @@ struct flagellation_cleanse_t : public rogue_spell_t
     rogue_spell_t( name, p, p->covenant.flagellation_buff, options_str )
   {
     // TOCHECK: See if this is on the GCD or not
+    // ready() does not check the cooldown
+    cooldown_gated_ready = false;
   }
 
   void execute() override
@@ -13,20 +13,22 @@
 
 namespace
 {
+const dbc::name_dbc_index_t<active_class_spell_t, decltype( &active_class_spell_t::name )> class_name_index(
+    &active_class_spell_t::name );
+const dbc::name_dbc_index_t<active_pet_spell_t, decltype( &active_pet_spell_t::name )> pet_name_index(
+    &active_pet_spell_t::name );
+
 const active_class_spell_t& __find_class( util::string_view name,
                                           bool              ptr,
                                           bool              tokenized,
                                           player_e          class_,
                                           specialization_e  spec )
 {
-  std::string name_str = tokenized ? util::tokenize_fn( name ) : std::string( name );
   unsigned class_id = util::class_id( class_ );
   unsigned spec_id = static_cast<unsigned>( spec );
 
-  const auto __data = active_class_spell_t::data( ptr );
-
-  auto it = range::find_if( __data,
-  [&name_str, tokenized, class_id, spec_id]( const active_class_spell_t& e ) {
+  auto entry = class_name_index.find( name, ptr, tokenized,
+  [class_id, spec_id]( const active_class_spell_t& e ) {
     if ( class_id != 0 && e.class_id != class_id )
     {
       return false;
@@ -37,16 +39,15 @@ const active_class_spell_t& __find_class( util::string_view name,
       return false;
     }
 
-    auto str = tokenized ? util::tokenize_fn( e.name ) : e.name;
-    return util::str_compare_ci( name_str, str );
+    return true;
   } );
 
-  if ( it == __data.cend() )
+  if ( !entry )
   {
     return active_class_spell_t::nil();
   }
 
-  return *it;
+  return *entry;
 }
 
 const active_pet_spell_t& __find_pet( util::string_view name,
@@ -54,28 +55,19 @@ const active_pet_spell_t& __find_pet( util::string_view name,
                                       bool              tokenized,
                                       player_e          class_)
 {
-  std::string name_str = tokenized ? util::tokenize_fn( name ) : std::string( name );
   unsigned class_id = util::class_id( class_ );
 
-  const auto __data = active_pet_spell_t::data( ptr );
-
-  auto it = range::find_if( __data,
-  [&name_str, tokenized, class_id]( const active_pet_spell_t& e ) {
-    if ( class_id != 0 && e.owner_class_id != class_id )
-    {
-      return false;
-    }
-
-    auto str = tokenized ? util::tokenize_fn( e.name ) : e.name;
-    return util::str_compare_ci( name_str, str );
+  auto entry = pet_name_index.find( name, ptr, tokenized,
+  [class_id]( const active_pet_spell_t& e ) {
+    return class_id == 0 || e.owner_class_id == class_id;
   } );
 
-  if ( it == __data.cend() )
+  if ( !entry )
   {
     return active_pet_spell_t::nil();
   }
 
-  return *it;
+  return *entry;
 }
 } // Namespace anonymous ends
 
@@ -9,6 +9,13 @@
 #include "generated/client_data_version_ptr.inc"
 #endif
 
+std::string dbc::name_index_key( util::string_view name, bool tokenized )
+{
+  auto key = tokenized ? util::tokenize_fn( name ) : std::string( name );
+  util::tolower( key );
+  return key;
+}
+
 std::string dbc::client_data_version_str( bool ptr )
 {
 #if SC_USE_PTR == 1
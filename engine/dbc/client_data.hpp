@@ -8,11 +8,14 @@
 #include "config.hpp"
 
 #include <algorithm>
+#include <functional>
+#include <mutex>
 #include <vector>
 #include <string>
 
 #include "util/generic.hpp"
 #include "util/span.hpp"
+#include "util/string_view.hpp"
 
 namespace dbc
 {
@@ -104,6 +107,83 @@ public:
   }
 };
 
+// Lookup key of a name for name_dbc_index_t, the lowercase (and tokenized, if tokenized is set)
+// name
+std::string name_index_key( util::string_view name, bool tokenized );
+
+// Name index of dbc data, replacing linear searches by (case insensitive, optionally tokenized)
+// name. Built on first use, and returns the same record as a linear search would: the first one
+// in data order that matches the name and the given predicate.
+template <typename T, typename Proj>
+class name_dbc_index_t
+{
+  using entry_t = std::pair<size_t, const T*>; // ( key hash, record )
+
+  struct index_t
+  {
+    std::once_flag       init;
+    std::vector<entry_t> entries;
+  };
+
+#if SC_USE_PTR == 0
+  mutable index_t __index[ 1 ][ 2 ];
+#else
+  mutable index_t __index[ 2 ][ 2 ];
+#endif
+  Proj proj;
+
+  static util::string_view name_of( const char* name )
+  { return name ? name : util::string_view(); }
+
+  static util::string_view name_of( util::string_view name )
+  { return name; }
+
+  const std::vector<entry_t>& index( bool ptr, bool tokenized ) const
+  {
+    auto& index = __index[ ptr ][ tokenized ];
+    std::call_once( index.init, [ this, &index, ptr, tokenized ]() {
+      for ( const auto& entry : T::data( ptr ) )
+      {
+        auto key = name_index_key( name_of( range::invoke( proj, entry ) ), tokenized );
+        index.entries.emplace_back( std::hash<std::string>()( key ), &entry );
+      }
+
+      // Stable sort keeps records with the same key in data order
+      std::stable_sort( index.entries.begin(), index.entries.end(),
+                        []( const entry_t& l, const entry_t& r ) { return l.first < r.first; } );
+    } );
+
+    return index.entries;
+  }
+
+public:
+  name_dbc_index_t( Proj p ) : proj( p )
+  { }
+
+  template <typename Predicate>
+  const T* find( util::string_view name, bool ptr, bool tokenized, Predicate&& pred ) const
+  {
+    const auto& entries = index( ptr, tokenized );
+    auto key = name_index_key( name, tokenized );
+
+    auto r = std::equal_range( entries.begin(), entries.end(), entry_t( std::hash<std::string>()( key ), nullptr ),
+                               []( const entry_t& l, const entry_t& r ) { return l.first < r.first; } );
+    for ( auto it = r.first; it != r.second; ++it )
+    {
+      const T* entry = it -> second;
+      if ( name_index_key( name_of( range::invoke( proj, *entry ) ), tokenized ) == key && pred( *entry ) )
+      {
+        return entry;
+      }
+    }
+
+    return nullptr;
+  }
+
+  const T* find( util::string_view name, bool ptr, bool tokenized = false ) const
+  { return find( name, ptr, tokenized, []( const T& ) { return true; } ); }
+};
+
 // Return World of Warcraft client data version used to generate the current client data
 std::string client_data_version_str( bool ptr );
 // Return World of Warcraft client data build version used to generate the current client data
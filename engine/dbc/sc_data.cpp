@@ -644,8 +644,10 @@ spell_data_t* custom_dbc_data_t::create_clone( const spell_data_t* source )
     e_clone = e_source;
     add_effect( &e_clone );
 
-    // Link cloned spell to cloned effect
+    // Link cloned spell to cloned effect. The trigger spell of a client data effect is resolved
+    // on access, so link it explicitly.
     e_clone._spell = clone;
+    e_clone._trigger_spell = e_source.trigger();
 
     // No trigger set up in the source effect, so processing for this effect can end here.
     if ( e_source.trigger() -> id() == 0 || e_source.trigger() -> drivers().empty() )
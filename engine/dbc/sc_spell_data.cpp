@@ -15,8 +15,15 @@
 #include "sim/sc_sim.hpp"
 #include "player/covenant.hpp"
 #include "player/runeforge_data.hpp"
+#include "util/concurrency.hpp"
 #include "util/util.hpp"
 
+#include <map>
+#include <mutex>
+#ifndef SC_NO_THREADING
+#include <thread>
+#endif
+
 namespace { // anonymous namespace ==========================================
 
 enum sdata_field_type_t : int
@@ -43,6 +50,7 @@ struct sdata_field_t
     using func_t = field_data_t(*)( const dbc_t&, const void* );
     sdata_field_type_t type;
     func_t             get;
+    bool               indexed; // Plain data member, queries can use a column index of the field
   };
 
   util::string_view   name;
@@ -98,7 +106,7 @@ template <typename Field>
 constexpr sdata_field_t::field_data_getter_t data_field( Field ) {
   using data_type = typename Field::object_type;
   using result_type = decltype( Field{}( std::declval<const data_type&>() ) );
-  return { field_type<result_type>(), get_data_field<data_type, Field> };
+  return { field_type<result_type>(), get_data_field<data_type, Field>, true };
 }
 
 } // namespace detail
@@ -111,7 +119,7 @@ struct func_field_t {
 
   constexpr operator sdata_field_t::field_data_getter_t() const {
     using result_type = decltype( Impl{}( std::declval<const dbc_t&>(), std::declval<const DataType&>() ) );
-    return { detail::field_type<result_type>(), get };
+    return { detail::field_type<result_type>(), get, false };
   }
 };
 
@@ -436,6 +444,344 @@ util::span<const sdata_field_t> data_fields_by_type( expr_data_e type, bool effe
   return { _spell_data_fields };
 }
 
+// Spell id list set operations =============================================
+
+using id_list_t = std::vector<uint32_t>;
+
+enum id_set_op_e
+{
+  ID_SET_AND = 0,
+  ID_SET_OR,
+  ID_SET_SUB
+};
+
+// Set operation on two sorted, unique id lists. Dense lists are combined as bitmaps of the id
+// range (one bit per id), sparse lists are merged.
+id_list_t id_set_op( const id_list_t& l, const id_list_t& r, id_set_op_e op )
+{
+  const uint32_t max_id = std::max( l.empty() ? 0u : l.back(), r.empty() ? 0u : r.back() );
+  const size_t n_words = max_id / 64 + 1;
+
+  id_list_t res;
+  if ( ! spell_data_expr_t::indexed || n_words > l.size() + r.size() )
+  {
+    switch ( op )
+    {
+      case ID_SET_AND: range::set_intersection( l, r, std::back_inserter( res ) ); break;
+      case ID_SET_OR:  range::set_union( l, r, std::back_inserter( res ) ); break;
+      case ID_SET_SUB: range::set_difference( l, r, std::back_inserter( res ) ); break;
+    }
+    return res;
+  }
+
+  std::vector<uint64_t> l_bits( n_words ), r_bits( n_words );
+  for ( auto id : l )
+    l_bits[ id / 64 ] |= uint64_t( 1 ) << ( id % 64 );
+  for ( auto id : r )
+    r_bits[ id / 64 ] |= uint64_t( 1 ) << ( id % 64 );
+
+  res.reserve( op == ID_SET_OR ? l.size() + r.size() : l.size() );
+  for ( size_t word_idx = 0; word_idx < n_words; ++word_idx )
+  {
+    uint64_t word = 0;
+    switch ( op )
+    {
+      case ID_SET_AND: word = l_bits[ word_idx ] & r_bits[ word_idx ]; break;
+      case ID_SET_OR:  word = l_bits[ word_idx ] | r_bits[ word_idx ]; break;
+      case ID_SET_SUB: word = l_bits[ word_idx ] & ~r_bits[ word_idx ]; break;
+    }
+
+    for ( uint32_t bit = 0; word; ++bit, word >>= 1 )
+    {
+      if ( word & 1 )
+        res.push_back( as<uint32_t>( word_idx * 64 + bit ) );
+    }
+  }
+
+  return res;
+}
+
+// Minimum number of ids per thread before a filtering scan is split across threads
+constexpr size_t MIN_SCAN_CHUNK_SIZE = 8192;
+
+// Ids of the (sorted) list accepted by the filter, in list order. Large lists are scanned in
+// parallel, the filter must only read client data.
+template <typename Filter>
+id_list_t filter_ids( const id_list_t& ids, Filter&& filter )
+{
+#ifndef SC_NO_THREADING
+  const size_t n_threads = std::min<size_t>( sc_thread_t::cpu_thread_count(), ids.size() / MIN_SCAN_CHUNK_SIZE );
+  if ( spell_data_expr_t::indexed && n_threads > 1 )
+  {
+    const size_t chunk_size = ( ids.size() + n_threads - 1 ) / n_threads;
+    std::vector<id_list_t> results( n_threads );
+    std::vector<std::exception_ptr> errors( n_threads );
+
+    auto scan = [ & ]( size_t chunk ) {
+      try
+      {
+        auto begin = ids.begin() + std::min( ids.size(), chunk * chunk_size );
+        auto end = ids.begin() + std::min( ids.size(), ( chunk + 1 ) * chunk_size );
+        std::copy_if( begin, end, std::back_inserter( results[ chunk ] ), filter );
+      }
+      catch ( ... )
+      {
+        errors[ chunk ] = std::current_exception();
+      }
+    };
+
+    std::vector<std::thread> threads;
+    for ( size_t chunk = 1; chunk < n_threads; ++chunk )
+      threads.emplace_back( scan, chunk );
+    scan( 0 );
+    range::for_each( threads, []( std::thread& t ) { t.join(); } );
+
+    for ( const auto& error : errors )
+    {
+      if ( error )
+        std::rethrow_exception( error );
+    }
+
+    id_list_t res;
+    for ( const auto& result : results )
+      res.insert( res.end(), result.begin(), result.end() );
+    return res;
+  }
+#endif
+
+  id_list_t res;
+  range::copy_if( ids, std::back_inserter( res ), filter );
+  return res;
+}
+
+// Spell query indexes ======================================================
+
+// Client data tables a spell list can refer to. Effect queries (spell.effect.<field>) match spells
+// through their effects.
+enum index_table_e
+{
+  INDEX_SPELL = 0,
+  INDEX_TALENT,
+  INDEX_EFFECT,
+  INDEX_SPELL_EFFECT,
+  INDEX_TABLE_MAX
+};
+
+// Precomputed id lists of records with a given property, answering the class, race, school and
+// label queries
+enum index_key_e
+{
+  KEY_SPELL_CLASS = 0, // class_mask() & value
+  KEY_SPELL_FAMILY,    // class_family() == value
+  KEY_SPELL_RACE,      // race_mask() & value
+  KEY_SPELL_SCHOOL,    // ( school_mask() & value ) == value
+  KEY_SPELL_ANY_SCHOOL,// school_mask() & value
+  KEY_SPELL_LABEL,     // label value applied to the spell
+  KEY_TALENT_CLASS     // mask_class() & value
+};
+
+// Indexes of the client data tables for the spell query engine, built on first use. Only plain
+// data fields are indexed, fields computed through dbc_t are always scanned.
+class spell_query_index_t
+{
+public:
+  // ( field value, id ) pairs of all records of a table, sorted by value
+  using column_t = std::vector<std::pair<double, uint32_t>>;
+
+private:
+  using column_key_t = std::pair<index_table_e, sdata_field_t::field_data_getter_t::func_t>;
+
+  bool                                                  ptr;
+  std::mutex                                            mutex;
+  std::array<std::unique_ptr<id_list_t>, INDEX_TABLE_MAX> table_id_lists;
+  std::map<column_key_t, std::unique_ptr<column_t>>     columns;
+  std::map<std::pair<index_key_e, uint64_t>, std::unique_ptr<id_list_t>> keys;
+
+  template <typename Fn>
+  void for_each_record( index_table_e table, Fn&& fn ) const
+  {
+    switch ( table )
+    {
+      case INDEX_SPELL:
+        for ( const auto& spell : spell_data_t::data( ptr ) )
+          fn( spell.id(), spell );
+        break;
+      case INDEX_TALENT:
+        for ( const auto& talent : talent_data_t::data( ptr ) )
+          fn( talent.id(), talent );
+        break;
+      case INDEX_EFFECT:
+        for ( const auto& effect : spelleffect_data_t::data( ptr ) )
+          fn( effect.id(), effect );
+        break;
+      case INDEX_SPELL_EFFECT:
+        for ( const auto& spell : spell_data_t::data( ptr ) )
+        {
+          for ( const spelleffect_data_t& effect : spell.effects() )
+          {
+            if ( effect.id() > 0 )
+              fn( spell.id(), effect );
+          }
+        }
+        break;
+      default:
+        assert( false );
+        break;
+    }
+  }
+
+  id_list_t build_key( index_key_e key, uint64_t value ) const
+  {
+    id_list_t ids;
+    auto add_spells = [ this, &ids ]( auto&& pred ) {
+      for ( const auto& spell : spell_data_t::data( ptr ) )
+      {
+        if ( pred( spell ) )
+          ids.push_back( spell.id() );
+      }
+    };
+
+    switch ( key )
+    {
+      case KEY_SPELL_CLASS:
+        add_spells( [ value ]( const spell_data_t& spell ) { return ( spell.class_mask() & value ) != 0; } );
+        break;
+      case KEY_SPELL_FAMILY:
+        add_spells( [ value ]( const spell_data_t& spell ) { return spell.class_family() == value; } );
+        break;
+      case KEY_SPELL_RACE:
+        add_spells( [ value ]( const spell_data_t& spell ) { return ( spell.race_mask() & value ) != 0; } );
+        break;
+      case KEY_SPELL_SCHOOL:
+        add_spells( [ value ]( const spell_data_t& spell ) { return ( spell.school_mask() & value ) == value; } );
+        break;
+      case KEY_SPELL_ANY_SCHOOL:
+        add_spells( [ value ]( const spell_data_t& spell ) { return ( spell.school_mask() & value ) != 0; } );
+        break;
+      case KEY_SPELL_LABEL:
+        for ( const auto& label : spelllabel_data_t::data( ptr ) )
+        {
+          if ( label.label() == static_cast<short>( value ) )
+            ids.push_back( label.id_spell() );
+        }
+        break;
+      case KEY_TALENT_CLASS:
+        for ( const auto& talent : talent_data_t::data( ptr ) )
+        {
+          if ( talent.mask_class() & value )
+            ids.push_back( talent.id() );
+        }
+        break;
+      default:
+        assert( false );
+        break;
+    }
+
+    ids.resize( range::unique( range::sort( ids ) ) - ids.begin() );
+    return ids;
+  }
+
+public:
+  explicit spell_query_index_t( bool ptr ) : ptr( ptr )
+  { }
+
+  size_t table_size( index_table_e table ) const
+  {
+    switch ( table )
+    {
+      case INDEX_TALENT: return talent_data_t::data( ptr ).size();
+      case INDEX_EFFECT: return spelleffect_data_t::data( ptr ).size();
+      default:           return spell_data_t::data( ptr ).size();
+    }
+  }
+
+  // Sorted ids of all records of the table
+  const id_list_t& table_ids( index_table_e table )
+  {
+    std::lock_guard<std::mutex> lock( mutex );
+
+    auto& ids = table_id_lists[ table == INDEX_SPELL_EFFECT ? INDEX_SPELL : table ];
+    if ( ! ids )
+    {
+      ids = std::make_unique<id_list_t>();
+      for_each_record( table == INDEX_SPELL_EFFECT ? INDEX_SPELL : table,
+                       [ &ids ]( uint32_t id, const auto& ) { ids -> push_back( id ); } );
+      ids -> resize( range::unique( range::sort( *ids ) ) - ids -> begin() );
+    }
+
+    return *ids;
+  }
+
+  // Values of a plain numeric field for all records of the table
+  const column_t& column( index_table_e table, const sdata_field_t& field, const dbc_t& dbc )
+  {
+    assert( field.data.indexed && field.data.type == SD_TYPE_NUM );
+
+    std::lock_guard<std::mutex> lock( mutex );
+
+    auto& column = columns[ column_key_t( table, field.data.get ) ];
+    if ( ! column )
+    {
+      column = std::make_unique<column_t>();
+      for_each_record( table, [ &column, &field, &dbc ]( uint32_t id, const auto& record ) {
+        column -> emplace_back( field.data.get( dbc, &record ).num, id );
+      } );
+      range::sort( *column );
+    }
+
+    return *column;
+  }
+
+  // Sorted ids of the records with the given property
+  const id_list_t& key_ids( index_key_e key, uint64_t value )
+  {
+    std::lock_guard<std::mutex> lock( mutex );
+
+    auto& ids = keys[ std::make_pair( key, value ) ];
+    if ( ! ids )
+    {
+      ids = std::make_unique<id_list_t>( build_key( key, value ) );
+    }
+
+    return *ids;
+  }
+};
+
+spell_query_index_t& query_index( bool ptr )
+{
+  static spell_query_index_t index( false ), ptr_index( true );
+  return ptr ? ptr_index : index;
+}
+
+// Sorted ids of the column entries whose value compares to the given value as t
+id_list_t column_ids( const spell_query_index_t::column_t& column, double value, expression::token_e t )
+{
+  using entry_t = spell_query_index_t::column_t::value_type;
+  auto lower = std::lower_bound( column.begin(), column.end(), value,
+                                 []( const entry_t& e, double v ) { return e.first < v; } );
+  auto upper = std::upper_bound( lower, column.end(), value,
+                                 []( double v, const entry_t& e ) { return v < e.first; } );
+
+  id_list_t ids;
+  auto add = [ &ids ]( auto begin, auto end ) {
+    std::transform( begin, end, std::back_inserter( ids ), []( const entry_t& e ) { return e.second; } );
+  };
+
+  switch ( t )
+  {
+    case expression::TOK_EQ:    add( lower, upper ); break;
+    case expression::TOK_NOTEQ: add( column.begin(), lower ); add( upper, column.end() ); break;
+    case expression::TOK_LT:    add( column.begin(), lower ); break;
+    case expression::TOK_LTEQ:  add( column.begin(), upper ); break;
+    case expression::TOK_GT:    add( upper, column.end() ); break;
+    case expression::TOK_GTEQ:  add( lower, column.end() ); break;
+    default: break;
+  }
+
+  ids.resize( range::unique( range::sort( ids ) ) - ids.begin() );
+  return ids;
+}
+
 // Generic spell list based expression, holds intersection, union for list
 // For these expression types, you can only use two spell lists as parameters
 struct spell_list_expr_t : public spell_data_expr_t
@@ -559,9 +905,7 @@ struct spell_list_expr_t : public spell_data_expr_t
     if ( other.result_tok != expression::TOK_SPELL_LIST )
       throw_invalid_op_arg( "&", other );
 
-    std::vector<uint32_t> res;
-    range::set_intersection( result_spell_list, other.result_spell_list, std::back_inserter( res ) );
-    return res;
+    return id_set_op( result_spell_list, other.result_spell_list, ID_SET_AND );
   }
 
   // Merge two spell lists, uniqueing entries
@@ -571,9 +915,7 @@ struct spell_list_expr_t : public spell_data_expr_t
     if ( other.result_tok != expression::TOK_SPELL_LIST )
       throw_invalid_op_arg( "|", other );
 
-    std::vector<uint32_t> res;
-    range::set_union( result_spell_list, other.result_spell_list, std::back_inserter( res ) );
-    return res;
+    return id_set_op( result_spell_list, other.result_spell_list, ID_SET_OR );
   }
 
   // Subtract two spell lists, other from this
@@ -583,39 +925,97 @@ struct spell_list_expr_t : public spell_data_expr_t
     if ( other.result_tok != expression::TOK_SPELL_LIST )
       throw_invalid_op_arg( "-", other );
 
-    std::vector<uint32_t> res;
-    range::set_difference( result_spell_list, other.result_spell_list, std::back_inserter( res ) );
+    return id_set_op( result_spell_list, other.result_spell_list, ID_SET_SUB );
+  }
+
+  index_table_e index_table() const
+  {
+    if ( effect_query )
+      return INDEX_SPELL_EFFECT;
+
+    switch ( data_type )
+    {
+      case DATA_TALENT: return INDEX_TALENT;
+      case DATA_EFFECT: return INDEX_EFFECT;
+      default:          return INDEX_SPELL;
+    }
+  }
+
+  // Large result lists are filtered through the indexes of the table, small lists are cheaper to
+  // scan than to build an index for
+  bool use_index() const
+  {
+    return indexed && result_spell_list.size() * 4 >= query_index( dbc.ptr ).table_size( index_table() );
+  }
+
+  // Filter the result list by the (sorted) ids of the matching records of the table. Ids that are
+  // not in the table (e.g., class spells missing from the spell data) are checked with the filter.
+  template <typename Filter>
+  std::vector<uint32_t> filter_indexed( const id_list_t& matches, Filter&& filter ) const
+  {
+    const auto& table_ids = query_index( dbc.ptr ).table_ids( index_table() );
+
+    auto res = id_set_op( result_spell_list, matches, ID_SET_AND );
+    auto missing = id_set_op( result_spell_list, table_ids, ID_SET_SUB );
+    if ( ! missing.empty() )
+      res = id_set_op( res, filter_ids( missing, filter ), ID_SET_OR );
+
     return res;
   }
 
+  // Matching records of the table, all records that do not match the index ids
+  id_list_t index_complement( const id_list_t& ids ) const
+  {
+    return id_set_op( query_index( dbc.ptr ).table_ids( index_table() ), ids, ID_SET_SUB );
+  }
+
+  template <typename Filter>
+  auto spell_filter( Filter& filter ) const
+  {
+    return [ this, &filter ]( uint32_t result_spell ) {
+      const spell_data_t* spell = dbc.spell( result_spell );
+      return spell && filter( *spell );
+    };
+  }
+
   template <typename Filter>
   std::vector<uint32_t> filter_spells( Filter&& filter ) const
   {
     if ( data_type == DATA_TALENT || data_type == DATA_EFFECT )
       return {};
 
-    std::vector<uint32_t> res;
-    range::copy_if( result_spell_list, std::back_inserter( res ),
-        [&]( uint32_t result_spell ) {
-          const spell_data_t* spell = dbc.spell( result_spell );
-          return spell && filter( *spell );
-        } );
-    return res;
+    return filter_ids( result_spell_list, spell_filter( filter ) );
   }
 
-  template <typename Filter>
-  std::vector<uint32_t> filter_talents( Filter&& filter ) const
+  // Filter spells, or if the list is large enough, intersect it with the spell ids the index
+  // function returns. Both must agree on the set of matching spells.
+  template <typename Filter, typename Index>
+  std::vector<uint32_t> filter_spells( Filter&& filter, Index&& index ) const
+  {
+    if ( data_type == DATA_TALENT || data_type == DATA_EFFECT )
+      return {};
+
+    if ( use_index() )
+      return filter_indexed( index(), spell_filter( filter ) );
+
+    return filter_ids( result_spell_list, spell_filter( filter ) );
+  }
+
+  template <typename Filter, typename Index>
+  std::vector<uint32_t> filter_talents( Filter&& filter, Index&& index ) const
   {
     if ( data_type != DATA_TALENT )
       return {};
 
-    std::vector<uint32_t> res;
-    range::copy_if( result_spell_list, std::back_inserter( res ),
-        [&]( uint32_t result_spell ) {
-          const talent_data_t* talent = dbc.talent( result_spell );
-          return talent && filter( *talent );
-        } );
-    return res;
+    auto talent_filter = [&]( uint32_t result_spell ) {
+      const talent_data_t* talent = dbc.talent( result_spell );
+      return talent && filter( *talent );
+    };
+
+    if ( use_index() )
+      return filter_indexed( index(), talent_filter );
+
+    return filter_ids( result_spell_list, talent_filter );
   }
 
   /* [[noreturn]] */ void throw_invalid_op_arg( util::string_view op, const spell_data_expr_t& other ) {
@@ -733,46 +1133,51 @@ struct spell_data_filter_expr_t : public spell_list_expr_t
     return false;
   }
 
-  std::vector<uint32_t> build_list( const spell_data_expr_t& other, expression::token_e t ) const
+  bool matches( uint32_t result_spell, const spell_data_expr_t& other, expression::token_e t ) const
   {
-    std::vector<uint32_t> res;
-
-    for ( const auto& result_spell : result_spell_list )
+    if ( effect_query )
     {
-      // Don't bother comparing if this spell id is already in the result set.
-      if ( range::find( res, result_spell ) != res.end() )
-        continue;
+      const spell_data_t& spell = *dbc.spell( result_spell );
 
-      if ( effect_query )
+      // Compare against every spell effect
+      for ( const spelleffect_data_t& effect : spell.effects() )
       {
-        const spell_data_t& spell = *dbc.spell( result_spell );
-
-        // Compare against every spell effect
-        for ( const spelleffect_data_t& effect : spell.effects() )
+        if ( effect.id() > 0 && dbc.effect( effect.id() ) &&
+             compare( &effect, other, t ) )
         {
-          if ( effect.id() > 0 && dbc.effect( effect.id() ) &&
-               compare( &effect, other, t ) )
-          {
-            res.push_back( result_spell );
-            break;
-          }
+          return true;
         }
       }
-      else
-      {
-        const void* p_data;
-        if ( data_type == DATA_TALENT )
-          p_data = dbc.talent( result_spell );
-        else if ( data_type == DATA_EFFECT )
-          p_data = dbc.effect( result_spell );
-        else
-          p_data = dbc.spell( result_spell );
-        if ( p_data && compare( p_data, other, t ) )
-          res.push_back( result_spell );
-      }
+
+      return false;
     }
 
-    return res;
+    const void* p_data;
+    if ( data_type == DATA_TALENT )
+      p_data = dbc.talent( result_spell );
+    else if ( data_type == DATA_EFFECT )
+      p_data = dbc.effect( result_spell );
+    else
+      p_data = dbc.spell( result_spell );
+
+    return p_data && compare( p_data, other, t );
+  }
+
+  std::vector<uint32_t> build_list( const spell_data_expr_t& other, expression::token_e t ) const
+  {
+    auto filter = [ this, &other, t ]( uint32_t result_spell ) {
+      return matches( result_spell, other, t );
+    };
+
+    // Numeric comparisons of plain data fields are answered from the column index of the field
+    if ( field.data.indexed && field.data.type == SD_TYPE_NUM && other.result_tok == expression::TOK_NUM &&
+         ! ( effect_query && data_type == DATA_TALENT ) && use_index() )
+    {
+      const auto& column = query_index( dbc.ptr ).column( index_table(), field, dbc );
+      return filter_indexed( column_ids( column, other.result_num, t ), filter );
+    }
+
+    return filter_ids( result_spell_list, filter );
   }
 
   std::vector<uint32_t> operator==( const spell_data_expr_t& other ) override
@@ -880,6 +1285,18 @@ struct spell_class_expr_t : public spell_list_expr_t
     return false;
   }
 
+  // Spells of the class in the result list, by class mask or by a spell class family check. Only
+  // the result list spells of the class family need to be checked.
+  id_list_t class_spells( unsigned class_mask, unsigned class_family ) const
+  {
+    auto& index = query_index( dbc.ptr );
+    auto family_spells = filter_ids(
+        id_set_op( result_spell_list, index.key_ids( KEY_SPELL_FAMILY, class_family ), ID_SET_AND ),
+        [ this ]( uint32_t spell_id ) { return check_spell_class_family( *dbc.spell( spell_id ) ); } );
+
+    return id_set_op( index.key_ids( KEY_SPELL_CLASS, class_mask ), family_spells, ID_SET_OR );
+  }
+
   std::vector<uint32_t> operator==( const spell_data_expr_t& other ) override
   {
     // Other types will not be allowed, e.g. you cannot do class=list
@@ -892,6 +1309,8 @@ struct spell_class_expr_t : public spell_list_expr_t
     {
       return filter_talents( [&]( const talent_data_t& talent ) {
           return talent.mask_class() & class_mask;
+        }, [&]() {
+          return query_index( dbc.ptr ).key_ids( KEY_TALENT_CLASS, class_mask );
         } );
     }
 
@@ -899,6 +1318,8 @@ struct spell_class_expr_t : public spell_list_expr_t
     return filter_spells( [&]( const spell_data_t& spell ) {
         return ( spell.class_mask() & class_mask ) ||
                ( spell.class_family() == class_family && check_spell_class_family( spell ) );
+      }, [&]() {
+        return class_spells( class_mask, class_family );
       } );
   }
 
@@ -914,6 +1335,8 @@ struct spell_class_expr_t : public spell_list_expr_t
     {
       return filter_talents( [&]( const talent_data_t& talent ) {
           return ( talent.mask_class() & class_mask ) == 0;
+        }, [&]() {
+          return index_complement( query_index( dbc.ptr ).key_ids( KEY_TALENT_CLASS, class_mask ) );
         } );
     }
 
@@ -921,6 +1344,8 @@ struct spell_class_expr_t : public spell_list_expr_t
     return filter_spells( [&]( const spell_data_t& spell ) {
         return ( spell.class_mask() & class_mask ) == 0 &&
                !( spell.class_family() == class_family && check_spell_class_family( spell ) );
+      }, [&]() {
+        return index_complement( class_spells( class_mask, class_family ) );
       } );
   }
 };
@@ -938,6 +1363,8 @@ struct spell_race_expr_t : public spell_list_expr_t
     const uint64_t race_mask = race_str_to_mask( other.result_str );
     return filter_spells( [&]( const spell_data_t& spell ) {
         return spell.race_mask() & race_mask;
+      }, [&]() {
+        return query_index( dbc.ptr ).key_ids( KEY_SPELL_RACE, race_mask );
       } );
   }
 
@@ -950,6 +1377,8 @@ struct spell_race_expr_t : public spell_list_expr_t
     const uint64_t race_mask = race_str_to_mask( other.result_str );
     return filter_spells( [&]( const spell_data_t& spell ) {
         return ( spell.race_mask() & race_mask ) == 0;
+      }, [&]() {
+        return index_complement( query_index( dbc.ptr ).key_ids( KEY_SPELL_RACE, race_mask ) );
       } );
   }
 };
@@ -1029,6 +1458,8 @@ struct spell_school_expr_t : public spell_list_expr_t
     const unsigned school_mask = school_str_to_mask( other.result_str );
     return filter_spells( [&]( const spell_data_t& spell ) {
         return ( spell.school_mask() & school_mask ) == school_mask;
+      }, [&]() {
+        return query_index( dbc.ptr ).key_ids( KEY_SPELL_SCHOOL, school_mask );
       } );
   }
 
@@ -1041,6 +1472,41 @@ struct spell_school_expr_t : public spell_list_expr_t
     const unsigned school_mask = school_str_to_mask( other.result_str );
     return filter_spells( [&]( const spell_data_t& spell ) {
         return ( spell.school_mask() & school_mask ) == 0;
+      }, [&]() {
+        return index_complement( query_index( dbc.ptr ).key_ids( KEY_SPELL_ANY_SCHOOL, school_mask ) );
+      } );
+  }
+};
+
+struct spell_label_expr_t : public spell_list_expr_t
+{
+  spell_label_expr_t( dbc_t& dbc, expr_data_e type ) : spell_list_expr_t( dbc, "label", type ) { }
+
+  std::vector<uint32_t> operator==( const spell_data_expr_t& other ) override
+  {
+    // Numbered labels only
+    if ( other.result_tok != expression::TOK_NUM )
+      return {};
+
+    const int label = as<int>( other.result_num );
+    return filter_spells( [&]( const spell_data_t& spell ) {
+        return spell.affected_by_label( label );
+      }, [&]() {
+        return query_index( dbc.ptr ).key_ids( KEY_SPELL_LABEL, label );
+      } );
+  }
+
+  std::vector<uint32_t> operator!=( const spell_data_expr_t& other ) override
+  {
+    // Numbered labels only
+    if ( other.result_tok != expression::TOK_NUM )
+      return {};
+
+    const int label = as<int>( other.result_num );
+    return filter_spells( [&]( const spell_data_t& spell ) {
+        return ! spell.affected_by_label( label );
+      }, [&]() {
+        return index_complement( query_index( dbc.ptr ).key_ids( KEY_SPELL_LABEL, label ) );
       } );
   }
 };
@@ -1142,6 +1608,8 @@ std::unique_ptr<spell_data_expr_t> spell_data_expr_t::create_spell_expression( d
     return std::make_unique<spell_flag_expr_t>( dbc, data_type );
   else if ( data_type != DATA_TALENT && util::str_compare_ci( splits[ 1 ], "school" ) )
     return std::make_unique<spell_school_expr_t>( dbc, data_type );
+  else if ( data_type != DATA_TALENT && util::str_compare_ci( splits[ 1 ], "label" ) )
+    return std::make_unique<spell_label_expr_t>( dbc, data_type );
 
   for ( const auto& field : data_fields_by_type( data_type, effect_query ) )
   {
@@ -1161,6 +1629,8 @@ std::unique_ptr<spell_data_expr_t> spell_data_expr_t::create_spell_expression( d
                                             data_type, util::string_join( valid_fields, ", " ) ) );
 }
 
+bool spell_data_expr_t::indexed = true;
+
 std::unique_ptr<spell_data_expr_t> spell_data_expr_t::parse( sim_t* sim, util::string_view expr_str )
 {
   if ( expr_str.empty() ) return nullptr;
@@ -11,6 +11,12 @@
 #include "generated/specialization_spells_ptr.inc"
 #endif
 
+namespace
+{
+const dbc::name_dbc_index_t<specialization_spell_entry_t, decltype( &specialization_spell_entry_t::name )> name_index(
+    &specialization_spell_entry_t::name );
+} // unnamed namespace
+
 util::span<const specialization_spell_entry_t> specialization_spell_entry_t::data( bool ptr )
 {
   return SC_DBC_GET_DATA( __specialization_spell_data, __ptr_specialization_spell_data, ptr );
@@ -23,18 +29,15 @@ specialization_spell_entry_t::find( util::string_view name,
                                     util::string_view desc,
                                     bool              tokenized )
 {
-  auto __data = data( ptr );
-
-  std::string cmp_str, desc_cmp_str;
+  std::string desc_cmp_str;
   if ( tokenized )
   {
-    cmp_str = util::tokenize_fn( name );
-    name = cmp_str;
     desc_cmp_str = util::tokenize_fn( desc );
     desc = desc_cmp_str;
   }
 
-  auto it = range::find_if( __data, [tokenized, spec, name, desc]( const auto& entry ) {
+  // Names are matched by the index, the predicate only checks the specialization and description
+  auto entry = name_index.find( name, ptr, tokenized, [tokenized, spec, desc]( const auto& entry ) {
       if ( spec != SPEC_NONE && spec != entry.specialization_id )
       {
         return false;
@@ -57,9 +60,6 @@ specialization_spell_entry_t::find( util::string_view name,
             return false;
           }
         }
-
-        auto spell_str = util::tokenize_fn( entry.name );
-        return util::str_compare_ci( spell_str, name );
       }
       else
       {
@@ -72,14 +72,14 @@ specialization_spell_entry_t::find( util::string_view name,
         {
           return false;
         }
-
-        return util::str_compare_ci( entry.name, name );
       }
+
+      return true;
   } );
 
-  if ( it != __data.end() )
+  if ( entry )
   {
-    return *it;
+    return *entry;
   }
 
   return nil();
@@ -2,6 +2,8 @@
 #include "spell_data.hpp"
 
 #include <array>
+#include <atomic>
+#include <functional>
 
 #include "generated/sc_spell_data.inc"
 #if SC_USE_PTR
@@ -18,6 +20,21 @@
 
 #include "fmt/format.h"
 
+namespace
+{
+// Trigger spells of the client data effects, indexed by the position of the effect in its table and
+// resolved on first access. The effect data is shared by all sims, so the links are kept here
+// instead of being written into the effects.
+std::unique_ptr<std::atomic<const spell_data_t*>[]> __effect_trigger_links[ 2 ];
+
+template <typename T, size_t N>
+bool in_table( const T* entry, util::span<const T, N> data )
+{
+  return std::less_equal<const T*>()( data.data(), entry ) &&
+         std::less<const T*>()( entry, data.data() + data.size() );
+}
+} // unnamed namespace
+
 // ==========================================================================
 // Spell Label Data - SpellLabel.db2
 // ==========================================================================
@@ -362,20 +379,68 @@ util::span<const spelleffect_data_t> spelleffect_data_t::data( bool ptr )
   return _data( ptr );
 }
 
+// Requires spell_data_t::link() to have linked the spells to their effects
 void spelleffect_data_t::link( bool ptr )
 {
-  for ( spelleffect_data_t& ed : _data( ptr ) )
+  auto __data = _data( ptr );
+
+  // Effects are stored in spell order, so the owning spell is known without a lookup
+  for ( const spell_data_t& sd : spell_data_t::data( ptr ) )
+  {
+    for ( const spelleffect_data_t& effect : sd.effects() )
+    {
+      if ( effect.id() != 0 && effect.spell_id() == sd.id() )
+      {
+        __data[ &effect - __data.data() ]._spell = &sd;
+      }
+    }
+  }
+
+  for ( spelleffect_data_t& ed : __data )
   {
     if ( ed.id() == 0 )
     {
       ed._spell = ed._trigger_spell = spell_data_t::not_found();
     }
-    else
+    else if ( ! ed._spell )
+    {
+      ed._spell = spell_data_t::find( ed.spell_id(), ptr );
+    }
+  }
+
+  // Trigger spells are resolved on first access, a sim only uses a small fraction of them
+  __effect_trigger_links[ ptr ].reset( new std::atomic<const spell_data_t*>[ __data.size() ]() );
+}
+
+const spell_data_t* spelleffect_data_t::linked_trigger() const
+{
+  for ( bool ptr : { false, true } )
+  {
+    if ( ptr && ! SC_USE_PTR )
+    {
+      break;
+    }
+
+    const auto __data = data( ptr );
+    if ( ! __effect_trigger_links[ ptr ] || ! in_table( this, __data ) )
     {
-      ed._spell         = spell_data_t::find( ed.spell_id(), ptr );
-      ed._trigger_spell = spell_data_t::find( ed.trigger_spell_id(), ptr );
+      continue;
     }
+
+    auto& link = __effect_trigger_links[ ptr ][ this - __data.data() ];
+    const spell_data_t* trigger = link.load( std::memory_order_acquire );
+    if ( ! trigger )
+    {
+      trigger = spell_data_t::find( trigger_spell_id(), ptr );
+      link.store( trigger, std::memory_order_release );
+    }
+
+    return trigger;
   }
+
+  // A copy of a client data effect, which tells its client data version through the owning spell
+  const bool ptr = SC_USE_PTR && in_table( _spell, spell_data_t::data( true ) );
+  return spell_data_t::find( trigger_spell_id(), ptr );
 }
 
 util::span<spelleffect_data_t> spelleffect_data_t::_data( bool ptr )
@@ -507,11 +572,12 @@ const spell_data_t* spell_data_t::find( unsigned spell_id, util::string_view con
 
 const spell_data_t* spell_data_t::find( util::string_view name, bool ptr )
 {
-  const auto __data = data( ptr );
-  auto it = range::find( __data, name, &spell_data_t::name_cstr );
-  if ( it != __data.end() )
-    return &*it;
-  return nullptr;
+  static const dbc::name_dbc_index_t<spell_data_t, decltype( &spell_data_t::name_cstr )> index(
+      &spell_data_t::name_cstr );
+
+  return index.find( name, ptr, false, [ name ]( const spell_data_t& spell ) {
+    return name == spell.name_cstr();
+  } );
 }
 
 util::span<const spell_data_t> spell_data_t::data( bool ptr )
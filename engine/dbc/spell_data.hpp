@@ -176,7 +176,8 @@ struct spelleffect_data_t
   double           _m_value;         // Misc multiplier used for some spells(?)
   double           _pvp_coeff;       // PvP Coefficient
 
-  // Pointers for runtime linking
+  // Pointers for runtime linking. The trigger spell of client data effects is resolved on first
+  // access, see trigger().
   const spell_data_t* _spell;
   const spell_data_t* _trigger_spell;
 
@@ -336,7 +337,7 @@ struct spelleffect_data_t
   { assert( _spell ); return _spell; }
 
   const spell_data_t* trigger() const
-  { assert( _trigger_spell ); return _trigger_spell; }
+  { return _trigger_spell ? _trigger_spell : linked_trigger(); }
 
   // Fetch value multiplier to be used based on the spell effect type/subtype
   // TODO: Still needs quite a few additions, test before using!
@@ -355,6 +356,8 @@ struct spelleffect_data_t
 private:
   static util::span<spelleffect_data_t> _data( bool ptr );
 
+  const spell_data_t* linked_trigger() const;
+
   double scaled_delta( double budget ) const;
   double scaled_min( double avg, double delta ) const;
   double scaled_max( double avg, double delta ) const;
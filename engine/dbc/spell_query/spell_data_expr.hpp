@@ -115,6 +115,10 @@ struct spell_data_expr_t
   virtual std::vector<uint32_t> in( const spell_data_expr_t& /* other */ ) { return std::vector<uint32_t>(); }
   virtual std::vector<uint32_t> not_in( const spell_data_expr_t& /* other */ ) { return std::vector<uint32_t>(); }
 
+  // Answer queries from client data indexes, combine dense lists as bitmaps and split large scans
+  // across threads. Off with spell_query_index=0, which scans and merges the result lists linearly.
+  static bool indexed;
+
   static std::unique_ptr<spell_data_expr_t> parse( sim_t* sim, util::string_view expr_str );
   static std::unique_ptr<spell_data_expr_t> create_spell_expression( dbc_t& dbc, util::string_view name_str );
 };
@@ -12,6 +12,12 @@
 #include "dbc/spell_data.hpp"
 #include "util/util.hpp"
 
+namespace
+{
+const dbc::name_dbc_index_t<talent_data_t, decltype( &talent_data_t::name_cstr )> talent_name_index(
+    &talent_data_t::name_cstr );
+} // unnamed namespace
+
 bool talent_data_t::is_class( player_e c ) const
 {
   unsigned mask = util::class_id_mask( c );
@@ -41,24 +47,17 @@ const talent_data_t* talent_data_t::find( unsigned id, util::string_view confirm
 
 const talent_data_t* talent_data_t::find( util::string_view name, specialization_e spec, bool ptr )
 {
-  for ( const talent_data_t& td : data( ptr ) )
-  {
-    if ( td.specialization() == spec && name == td.name_cstr() )
-      return &td;
-  }
-  return nullptr;
+  return talent_name_index.find( name, ptr, false, [ name, spec ]( const talent_data_t& td ) {
+    return td.specialization() == spec && name == td.name_cstr();
+  } );
 }
 
 const talent_data_t* talent_data_t::find_tokenized( util::string_view name, specialization_e spec, bool ptr )
 {
-  for ( const talent_data_t& td : data( ptr ) )
-  {
-    auto tokenized_name = util::tokenize_fn( td.name_cstr() );
-    if ( td.specialization() == spec && util::str_compare_ci( name, tokenized_name ) )
-      return &td;
-  }
-
-  return nullptr;
+  // The given name is expected to be tokenized already
+  return talent_name_index.find( name, ptr, true, [ name, spec ]( const talent_data_t& td ) {
+    return td.specialization() == spec && util::str_compare_ci( name, util::tokenize_fn( td.name_cstr() ) );
+  } );
 }
 
 const talent_data_t* talent_data_t::find( player_e c, unsigned int row, unsigned int col, specialization_e spec, bool ptr )
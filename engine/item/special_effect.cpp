@@ -946,7 +946,15 @@ void special_effect::parse_special_effect_encoding( special_effect_t& effect,
   if ( encoding.empty() || encoding == "custom" || encoding == "none" )
     return;
 
-   auto tokens = item_database::parse_tokens( encoding );
+  parse_special_effect_encoding( effect, encoding, item_database::parse_tokens( encoding ) );
+}
+
+void special_effect::parse_special_effect_encoding( special_effect_t& effect,
+                                          const std::string& encoding,
+                                          const std::vector<item_database::token_t>& tokens )
+{
+  if ( encoding.empty() || encoding == "custom" || encoding == "none" )
+    return;
 
   effect.encoding_str = encoding;
 
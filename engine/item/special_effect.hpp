@@ -29,9 +29,17 @@ struct spell_data_t;
 struct special_effect_t;
 struct stat_buff_t;
 
+namespace item_database
+{
+struct token_t;
+}
+
 namespace special_effect
 {
   void parse_special_effect_encoding( special_effect_t& effect, const std::string& str );
+  // Parse an encoding that has already been split into tokens with item_database::parse_tokens()
+  void parse_special_effect_encoding( special_effect_t& effect, const std::string& str,
+                                      const std::vector<item_database::token_t>& tokens );
   bool usable_proc( const special_effect_t& effect );
 }
 
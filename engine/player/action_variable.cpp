@@ -15,7 +15,8 @@ action_variable_t::action_variable_t( const std::string& name, double default_va
   : current_value_( default_value ),
     default_value_( default_value ),
     constant_value_( std::numeric_limits<double>::lowest() ),
-    name_( name )
+    name_( name ),
+    readers_( 0 )
 {
 }
 
@@ -5,21 +5,36 @@
 
 #pragma once
 
+#include <cassert>
 #include <string>
 #include <vector>
 
 struct action_t;
+struct variable_t;
 
 struct action_variable_t
 {
-  double current_value_, default_value_, constant_value_;
+private:
+  // Only written by the variable actions, and read by everything else through value()
+  double current_value_;
+
+  friend struct variable_t;
+
+public:
+  double default_value_, constant_value_;
   std::string name_;
   std::vector<action_t*> variable_actions;
+  // Number of consumers (variable expressions, print operations) of the variable value. Variables
+  // nobody reads are never evaluated.
+  unsigned readers_;
 
   action_variable_t( const std::string& name, double default_value );
 
+  // Variables nobody reads are not evaluated, so reading one that was not registered with
+  // add_reader() would see a stale value.
   double value() const
   {
+    assert( is_read() && "Reading an APL variable that has no registered readers" );
     return current_value_;
   }
 
@@ -28,6 +43,16 @@ struct action_variable_t
     current_value_ = default_value_;
   }
 
+  void add_reader()
+  {
+    ++readers_;
+  }
+
+  bool is_read() const
+  {
+    return readers_ > 0;
+  }
+
   bool is_constant( double* constant_value ) const;
 
   void optimize();
@@ -12,6 +12,7 @@
 #include <vector>
 
 struct action_state_t;
+struct player_t;
 
 // Assessors, currently a state assessor functionality is defined.
 namespace assessor
@@ -32,10 +33,23 @@ namespace assessor
   // State assessor callback type
   using state_assessor_t = std::function<command(result_amount_type, action_state_t*)>;
 
+  // Default outgoing damage assessors, run as direct calls. Assessors registered by modules are
+  // CUSTOM, and run through their state_assessor_t.
+  enum class stage_e
+  {
+    CUSTOM,
+    TARGET_MITIGATION,
+    TARGET_DAMAGE,
+    LOG,
+    LEECH,
+    CALLBACKS,
+  };
+
   // A simple entry that defines a state assessor
   struct state_assessor_entry_t
   {
     int priority;
+    stage_e stage;
     state_assessor_t assessor;
   };
 
@@ -53,14 +67,19 @@ namespace assessor
   // function, but it may not be freed. The function must return one of priority enum values,
   // typically priority::CONTINUE to continue the pipeline.
   //
-  // Assessors are sorted to ascending priority order in player_t::init_finished.
+  // Assessors are sorted to ascending priority order in player_t::init_finished. The default
+  // assessors are stages the pipeline calls directly (see player_t::init_assessors), so only
+  // assessors added by modules pay for a std::function call.
   //
   struct state_assessor_pipeline_t
   {
     std::vector<state_assessor_entry_t> assessors;
 
     void add( int p, state_assessor_t cb )
-    { assessors.push_back( state_assessor_entry_t{p, std::move(cb)} ); }
+    { assessors.push_back( state_assessor_entry_t{p, stage_e::CUSTOM, std::move(cb)} ); }
+
+    void add( int p, stage_e stage )
+    { assessors.push_back( state_assessor_entry_t{p, stage, nullptr} ); }
 
     void sort()
     {
@@ -68,15 +87,7 @@ namespace assessor
       { return a.priority < b.priority; } );
     }
 
-    void execute( result_amount_type type, action_state_t* state )
-    {
-      for ( const auto& a: assessors )
-      {
-        if ( a.assessor( type, state ) == STOP )
-        {
-          break;
-        }
-      }
-    }
+    // Run the pipeline of player on the state, defined with the default stages in sc_player.cpp
+    void execute( player_t* player, result_amount_type type, action_state_t* state );
   };
 } // Namespace assessor ends
@@ -2181,6 +2181,9 @@ struct reorigination_array_buff_t : public buff_t
     current_stat = STAT_NONE;
   }
 
+  bool is_reset() const override
+  { return buff_t::is_reset() && current_stat == STAT_NONE; }
+
   void execute( int stacks = 1, double value = DEFAULT_VALUE(),
                 timespan_t duration = timespan_t::min() ) override
   {
@@ -2618,6 +2621,9 @@ void swirling_sands( special_effect_t& effect )
       stat_buff_t::reset();
       extender -> deactivate();
     }
+
+    bool is_reset() const override
+    { return stat_buff_t::is_reset() && !extender -> active; }
   };
 
   struct swirling_sands_extender_t : public dbc_proc_callback_t
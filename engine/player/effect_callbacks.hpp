@@ -6,6 +6,7 @@
 #pragma once
 
 #include "config.hpp"
+#include "action/action_callback.hpp"
 #include "sim/sc_sim.hpp"
 #include "player/sc_player.hpp"
 #include "util/util.hpp"
@@ -30,7 +31,17 @@ struct effect_callbacks_t
 
   proc_array_t procs;
 
-  effect_callbacks_t( sim_t* sim ) : sim( sim )
+  // Callbacks of procs compiled into dispatch tables (see compile()), in registration order. The
+  // masks have a bit set for each proc_types2 list of a proc_types that has callbacks, so a proc
+  // check without any callbacks to trigger is a single bit test.
+  typedef typename T_CB::dispatch_list_t dispatch_list_t;
+  std::array<std::array<dispatch_list_t, PROC2_TYPE_MAX>, PROC1_TYPE_MAX> dispatch;
+  std::array<unsigned, PROC1_TYPE_MAX> dispatch_mask;
+  bool compiled;
+
+  static_assert( PROC2_TYPE_MAX <= 32, "proc_types2 masks must fit in 32 bits" );
+
+  effect_callbacks_t( sim_t* sim ) : sim( sim ), dispatch_mask(), compiled( false )
   { }
 
   bool has_callback( const std::function<bool(const T_CB*)> cmp ) const
@@ -43,6 +54,20 @@ struct effect_callbacks_t
 
   void register_callback( unsigned proc_flags, unsigned proc_flags2, T_CB* cb );
 
+  // (Re)build the dispatch tables from the registered callbacks. Done when the actor finishes
+  // initialization, callbacks registered after that rebuild the tables.
+  void compile();
+
+  // Trigger the callbacks of the given proc types
+  void trigger( proc_types pt, proc_types2 pt2, action_t* a, action_state_t* state )
+  {
+    if ( !compiled )
+      compile();
+
+    if ( dispatch_mask[ pt ] & ( 1U << pt2 ) )
+      T_CB::trigger( dispatch[ pt ][ pt2 ], a, state );
+  }
+
   // Helper to get first instance of object T and return it, if not found, return nullptr
   template <typename T>
   T* get_first_of() const
@@ -190,6 +215,30 @@ void effect_callbacks_t<T_CB>::register_callback(unsigned proc_flags,
       add_proc_callback(PROC1_PERIODIC_HEAL_TAKEN, proc_flags2, cb);
     }
   }
+
+  if (compiled)
+    compile();
+}
+
+template <typename T_CB>
+void effect_callbacks_t<T_CB>::compile()
+{
+  for ( proc_types pt = PROC1_TYPE_MIN; pt < PROC1_TYPE_MAX; pt++ )
+  {
+    dispatch_mask[ pt ] = 0;
+    for ( proc_types2 pt2 = PROC2_TYPE_MIN; pt2 < PROC2_TYPE_MAX; pt2++ )
+    {
+      auto& list = dispatch[ pt ][ pt2 ];
+      list.clear();
+      for ( auto cb : procs[ pt ][ pt2 ] )
+        list.add( cb );
+
+      if ( !list.empty() )
+        dispatch_mask[ pt ] |= 1U << pt2;
+    }
+  }
+
+  compiled = true;
 }
 
 template <typename T_CB>
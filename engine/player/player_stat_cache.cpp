@@ -7,6 +7,7 @@
 #include "sc_player.hpp"
 #include "action/sc_action_state.hpp"
 #include "action/sc_action.hpp"
+#include "sim/sc_sim.hpp"
 
 
 /**
@@ -14,6 +15,8 @@
  */
 void player_stat_cache_t::invalidate_all()
 {
+  player->invalidate_state();
+
   if ( !active )
     return;
 
@@ -28,6 +31,8 @@ void player_stat_cache_t::invalidate_all()
  */
 void player_stat_cache_t::invalidate( cache_e c )
 {
+  player->invalidate_state();
+
   switch ( c )
   {
     case CACHE_SPELL_POWER:
@@ -546,6 +551,97 @@ double player_stat_cache_t::player_heal_multiplier( const action_state_t* s ) co
   return _player_heal_mult[ sch ];
 }
 
+player_stat_cache_t::target_entry_t& player_stat_cache_t::target_entry( const player_t* target ) const
+{
+  if ( _target.size() <= target->actor_index )
+    _target.resize( target->actor_index + 1 );
+
+  auto& e = _target[ target->actor_index ];
+  auto version = player->state_version() + target->state_version();
+  if ( e.epoch != version || e.time != player->sim->current_time() )
+  {
+    e.epoch             = version;
+    e.time              = player->sim->current_time();
+    e.mult_valid        = 0;
+    e.crit_chance_valid = false;
+    e.armor_valid       = false;
+  }
+
+  return e;
+}
+
+// The target dependent values are only stored if computing them did not change actor state (e.g.,
+// by expiring a buff), the entry may also have been reset by a nested lookup in that case.
+
+double player_stat_cache_t::player_target_multiplier( player_t* t, school_e s ) const
+{
+  if ( !active )
+    return player->composite_player_target_multiplier( t, s );
+
+  if ( target_entry( t ).mult_valid & ( uint64_t( 1 ) << s ) )
+  {
+    assert( _target[ t->actor_index ].mult[ s ] == player->composite_player_target_multiplier( t, s ) );
+    return _target[ t->actor_index ].mult[ s ];
+  }
+
+  auto version = player->state_version() + t->state_version();
+  double m   = player->composite_player_target_multiplier( t, s );
+  if ( version == player->state_version() + t->state_version() )
+  {
+    auto& e = _target[ t->actor_index ];
+    e.mult_valid |= uint64_t( 1 ) << s;
+    e.mult[ s ] = m;
+  }
+
+  return m;
+}
+
+double player_stat_cache_t::player_target_crit_chance( player_t* t ) const
+{
+  if ( !active )
+    return player->composite_player_target_crit_chance( t );
+
+  if ( target_entry( t ).crit_chance_valid )
+  {
+    assert( _target[ t->actor_index ].crit_chance == player->composite_player_target_crit_chance( t ) );
+    return _target[ t->actor_index ].crit_chance;
+  }
+
+  auto version = player->state_version() + t->state_version();
+  double c   = player->composite_player_target_crit_chance( t );
+  if ( version == player->state_version() + t->state_version() )
+  {
+    auto& e = _target[ t->actor_index ];
+    e.crit_chance_valid = true;
+    e.crit_chance       = c;
+  }
+
+  return c;
+}
+
+double player_stat_cache_t::player_target_armor( player_t* t ) const
+{
+  if ( !active )
+    return player->composite_player_target_armor( t );
+
+  if ( target_entry( t ).armor_valid )
+  {
+    assert( _target[ t->actor_index ].armor == player->composite_player_target_armor( t ) );
+    return _target[ t->actor_index ].armor;
+  }
+
+  auto version = player->state_version() + t->state_version();
+  double a   = player->composite_player_target_armor( t );
+  if ( version == player->state_version() + t->state_version() )
+  {
+    auto& e = _target[ t->actor_index ];
+    e.armor_valid = true;
+    e.armor       = a;
+  }
+
+  return a;
+}
+
 #else
   // Passthrough cache stat functions for inactive cache
   double player_stat_cache_t::strength() const  { return _player -> strength();  }
@@ -7,7 +7,10 @@
 
 #include "config.hpp"
 #include "sc_enums.hpp"
+#include "util/timespan.hpp"
 #include <array>
+#include <cstdint>
+#include <vector>
 
 
 struct action_state_t;
@@ -58,6 +61,24 @@ private:
   mutable double _leech, _run_speed, _avoidance;
   mutable double _rppm_haste_coeff, _rppm_crit_coeff;
   mutable double _corruption, _corruption_resistance;
+
+  // Target dependent values, indexed by the actor index of the target. Class modules compute these
+  // from debuffs, target health and their own buffs without declaring cache invalidations for them,
+  // so an entry is only valid while the state versions of the player and the target (see
+  // player_t::state_version()) and the current time do not change. Changes of other actors, e.g.,
+  // damage to other targets of an aoe, keep it valid.
+  struct target_entry_t
+  {
+    uint64_t epoch = 0;
+    timespan_t time = timespan_t::min();
+    uint64_t mult_valid = 0;
+    bool crit_chance_valid = false, armor_valid = false;
+    double mult[ SCHOOL_MAX + 1 ], crit_chance, armor;
+  };
+  static_assert( SCHOOL_MAX + 1 <= 64, "School multiplier valid-states must fit in 64 bits" );
+  mutable std::vector<target_entry_t> _target;
+
+  target_entry_t& target_entry( const player_t* target ) const;
 public:
   bool active; // runtime active-flag
   void invalidate_all();
@@ -104,6 +125,9 @@ public:
   double corruption_resistance() const;
   double rppm_haste_coeff() const;
   double rppm_crit_coeff() const;
+  double player_target_multiplier( player_t* target, school_e ) const;
+  double player_target_crit_chance( player_t* target ) const;
+  double player_target_armor( player_t* target ) const;
 #else
   // Passthrough cache stat functions for inactive cache
   double strength() const  { return _player -> strength();  }
@@ -139,5 +163,8 @@ public:
   double avoidance() const { return _player -> composite_avoidance(); }
   double corruption() const { return _player -> composite_corruption(); }
   double corruption_resistance() const { return _player -> composite_corruption_resistance(); }
+  double player_target_multiplier( player_t* t, school_e s ) const { return _player -> composite_player_target_multiplier( t, s ); }
+  double player_target_crit_chance( player_t* t ) const { return _player -> composite_player_target_crit_chance( t ); }
+  double player_target_armor( player_t* t ) const { return _player -> composite_player_target_armor( t ); }
 #endif
 };
\ No newline at end of file
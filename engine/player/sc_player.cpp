@@ -2984,83 +2984,131 @@ void player_t::init_actions()
   }
 }
 
+namespace
+{
+// Default outgoing damage assessor stages, see player_t::init_assessors
+
+void assess_target_mitigation( result_amount_type dmg_type, action_state_t* state )
+{
+  state->target->assess_damage( state->action->get_school(), dmg_type, state );
+}
+
+void assess_target_damage( action_state_t* state )
+{
+  state->target->do_damage( state );
+}
+
+// Logging and debug .. Technically, this should probably be in action_t::assess_damage, but we
+// don't need this piece of code for the vast majority of sims, so it makes sense to yank it out
+// completely from there, and only conditionally include it if logging/debugging is enabled.
+void assess_log( player_t* player, result_amount_type type, action_state_t* state )
+{
+  sim_t* sim = player->sim;
+
+  if ( sim->debug )
+  {
+    state->debug();
+  }
+
+  if ( sim->log )
+  {
+    if ( type == result_amount_type::DMG_DIRECT )
+    {
+      sim->print_log( "{} {} hits {} for {} {} damage ({})", *player, state->action->name(),
+                           *state->target, state->result_amount,
+                           state->action->get_school(), state->result );
+    }
+    else  // result_amount_type::DMG_OVER_TIME
+    {
+      dot_t* dot = state->action->get_dot( state->target );
+      sim->print_log( "{} {} ticks ({} of {}) on {} for {} {} damage ({})", *player, state->action->name(),
+                           dot->current_tick, dot->num_ticks(), *state->target, state->result_amount,
+                           state->action->get_school(), state->result );
+    }
+  }
+}
+
+void assess_leech( player_t* player, action_state_t* state )
+{
+  // Leeching .. sanity check that the result type is a damaging one, so things hopefully don't
+  // break in the future if we ever decide to not separate heal and damage assessing.
+  double leech_pct = 0;
+  if ( ( state->result_type == result_amount_type::DMG_DIRECT || state->result_type == result_amount_type::DMG_OVER_TIME ) && state->result_amount > 0 &&
+       ( leech_pct = state->action->composite_leech( state ) ) > 0 )
+  {
+    double leech_amount       = leech_pct * state->result_amount;
+    player->spells.leech->base_dd_min = player->spells.leech->base_dd_max = leech_amount;
+    player->spells.leech->schedule_execute();
+  }
+}
+
+void assess_callbacks( player_t* player, action_state_t* state )
+{
+  if ( !state->action->callbacks )
+  {
+    return;
+  }
+
+  proc_types pt   = state->proc_type();
+  proc_types2 pt2 = state->impact_proc_type2();
+  if ( pt != PROC1_INVALID && pt2 != PROC2_INVALID )
+    player->callbacks.trigger( pt, pt2, state->action, state );
+}
+} // unnamed namespace
+
+void assessor::state_assessor_pipeline_t::execute( player_t* player, result_amount_type type, action_state_t* state )
+{
+  for ( const auto& a: assessors )
+  {
+    switch ( a.stage )
+    {
+      case stage_e::TARGET_MITIGATION:
+        assess_target_mitigation( type, state );
+        break;
+      case stage_e::TARGET_DAMAGE:
+        assess_target_damage( state );
+        break;
+      case stage_e::LOG:
+        assess_log( player, type, state );
+        break;
+      case stage_e::LEECH:
+        assess_leech( player, state );
+        break;
+      case stage_e::CALLBACKS:
+        assess_callbacks( player, state );
+        break;
+      default:
+        if ( a.assessor( type, state ) == STOP )
+        {
+          return;
+        }
+        break;
+    }
+  }
+}
+
 void player_t::init_assessors()
 {
   // Target related mitigation
-  assessor_out_damage.add( assessor::TARGET_MITIGATION, []( result_amount_type dmg_type, action_state_t* state ) {
-    state->target->assess_damage( state->action->get_school(), dmg_type, state );
-    return assessor::CONTINUE;
-  } );
+  assessor_out_damage.add( assessor::TARGET_MITIGATION, assessor::stage_e::TARGET_MITIGATION );
 
   // Target damage
-  assessor_out_damage.add( assessor::TARGET_DAMAGE, []( result_amount_type, action_state_t* state ) {
-    state->target->do_damage( state );
-    return assessor::CONTINUE;
-  } );
+  assessor_out_damage.add( assessor::TARGET_DAMAGE, assessor::stage_e::TARGET_DAMAGE );
 
-  // Logging and debug .. Technically, this should probably be in action_t::assess_damage, but we
-  // don't need this piece of code for the vast majority of sims, so it makes sense to yank it out
-  // completely from there, and only conditionally include it if logging/debugging is enabled.
+  // Logging and debug
   if ( sim->log || sim->debug || sim->debug_seed.size() > 0 )
   {
-    assessor_out_damage.add( assessor::LOG, [this]( result_amount_type type, action_state_t* state ) {
-      if ( sim->debug )
-      {
-        state->debug();
-      }
-
-      if ( sim->log )
-      {
-        if ( type == result_amount_type::DMG_DIRECT )
-        {
-          sim->print_log( "{} {} hits {} for {} {} damage ({})", *this, state->action->name(),
-                               *state->target, state->result_amount,
-                               state->action->get_school(), state->result );
-        }
-        else  // result_amount_type::DMG_OVER_TIME
-        {
-          dot_t* dot = state->action->get_dot( state->target );
-          sim->print_log( "{} {} ticks ({} of {}) on {} for {} {} damage ({})", *this, state->action->name(),
-                               dot->current_tick, dot->num_ticks(), *state->target, state->result_amount,
-                               state->action->get_school(), state->result );
-        }
-      }
-      return assessor::CONTINUE;
-    } );
+    assessor_out_damage.add( assessor::LOG, assessor::stage_e::LOG );
   }
 
   // Leech, if the player has leeching enabled (disabled by default)
   if ( spells.leech )
   {
-    assessor_out_damage.add( assessor::LEECH, [this]( result_amount_type, action_state_t* state ) {
-      // Leeching .. sanity check that the result type is a damaging one, so things hopefully don't
-      // break in the future if we ever decide to not separate heal and damage assessing.
-      double leech_pct = 0;
-      if ( ( state->result_type == result_amount_type::DMG_DIRECT || state->result_type == result_amount_type::DMG_OVER_TIME ) && state->result_amount > 0 &&
-           ( leech_pct = state->action->composite_leech( state ) ) > 0 )
-      {
-        double leech_amount       = leech_pct * state->result_amount;
-        spells.leech->base_dd_min = spells.leech->base_dd_max = leech_amount;
-        spells.leech->schedule_execute();
-      }
-      return assessor::CONTINUE;
-    } );
+    assessor_out_damage.add( assessor::LEECH, assessor::stage_e::LEECH );
   }
 
   // Generic actor callbacks
-  assessor_out_damage.add( assessor::CALLBACKS, [this]( result_amount_type, action_state_t* state ) {
-    if ( !state->action->callbacks )
-    {
-      return assessor::CONTINUE;
-    }
-
-    proc_types pt   = state->proc_type();
-    proc_types2 pt2 = state->impact_proc_type2();
-    if ( pt != PROC1_INVALID && pt2 != PROC2_INVALID )
-      action_callback_t::trigger( callbacks.procs[ pt ][ pt2 ], state->action, state );
-
-    return assessor::CONTINUE;
-  } );
+  assessor_out_damage.add( assessor::CALLBACKS, assessor::stage_e::CALLBACKS );
 }
 
 void player_t::init_finished()
@@ -3117,6 +3165,8 @@ void player_t::init_finished()
   // Sort outbound assessors
   assessor_out_damage.sort();
 
+  callbacks.compile();
+
   // Print items to debug log
   if ( sim->debug )
   {
@@ -4916,10 +4966,9 @@ bool compare( const buff_t* a, const buff_t* b )
   assert( a );
   assert( b );
 
-  if ( a->name_str < b->name_str )
-    return true;
-  if ( b->name_str < a->name_str )
-    return false;
+  // Equal names have equal symbols, so matching buffs skip the string comparison
+  if ( a->name_symbol != b->name_symbol )
+    return a->name_str < b->name_str;
 
   // NULL and player are identically considered "bottom" for source comparison
   bool a_is_bottom = ( !a->source || a->source == a->player );
@@ -5046,7 +5095,7 @@ void player_t::merge( player_t& other )
   for ( size_t i = 0; i < proc_list.size(); ++i )
   {
     proc_t& proc = *proc_list[ i ];
-    if ( proc_t* other_proc = other.find_proc( proc.name_str ) )
+    if ( proc_t* other_proc = other.proc_index.find( other.proc_list, proc.name_symbol ) )
       proc.merge( *other_proc );
     else
     {
@@ -5060,7 +5109,7 @@ void player_t::merge( player_t& other )
   for ( size_t i = 0; i < gain_list.size(); ++i )
   {
     gain_t& gain = *gain_list[ i ];
-    if ( gain_t* other_gain = other.find_gain( gain.name_str ) )
+    if ( gain_t* other_gain = other.gain_index.find( other.gain_list, gain.name_symbol ) )
       gain.merge( *other_gain );
     else
     {
@@ -5074,7 +5123,7 @@ void player_t::merge( player_t& other )
   for ( size_t i = 0; i < stats_list.size(); ++i )
   {
     stats_t& stats = *stats_list[ i ];
-    if ( stats_t* other_stats = other.find_stats( stats.name_str ) )
+    if ( stats_t* other_stats = other.stats_index.find( other.stats_list, stats.name_symbol ) )
       stats.merge( *other_stats );
     else
     {
@@ -5178,8 +5227,7 @@ void player_t::reset()
 
   sim->print_debug( "{} resets current stats ( reset to initial ): {}", *this, current );
 
-  for ( auto& buff : buff_list )
-    buff->reset();
+  buff_t::reset_dirty( sim, buff_list, dirty_buff_list );
 
   last_foreground_action = nullptr;
   prev_gcd_actions.clear();
@@ -5231,9 +5279,9 @@ void player_t::reset()
 
   range::for_each( action_list, []( action_t* action ) { action->reset(); } );
 
-  range::for_each( cooldown_list, []( cooldown_t* cooldown ) { cooldown->reset_init(); } );
+  cooldown_t::reset_dirty( sim, cooldown_list, dirty_cooldown_list );
 
-  range::for_each( dot_list, []( dot_t* dot ) { dot->reset(); } );
+  dot_t::reset_dirty( sim, dot_list, dirty_dot_list );
 
   range::for_each( stats_list, []( stats_t* stat ) { stat->reset(); } );
 
@@ -5559,6 +5607,8 @@ void player_t::arise()
     return;
 
   actor_spawn_index = sim->global_spawn_index++;
+  // Values computed from the set of active actors (e.g., target counts) may change
+  sim->actor_state_epoch++;
 
   sim->print_log( "{} arises. Spawn Index={}", *this, actor_spawn_index );
 
@@ -5650,6 +5700,7 @@ void player_t::demise()
     return;
 
   current.sleeping = true;
+  sim->actor_state_epoch++;
 
   if ( sim->log )
     sim->out_log.printf( "%s demises.. Spawn Index=%u", name(), actor_spawn_index );
@@ -5924,6 +5975,39 @@ void player_t::collect_resource_timeline_information()
   }
 }
 
+void player_t::invalidate_state() const
+{
+  // Owners are invalidated too, their actions may depend on the state of their pets
+  const player_t* p = this;
+  while ( true )
+  {
+    p->state_epoch++;
+
+    const player_t* owner = p->get_owner_or_self();
+    if ( owner == p )
+      break;
+    p = owner;
+  }
+}
+
+uint64_t player_t::state_version() const
+{
+  // The sum changes whenever one of the (increasing) epochs does
+  uint64_t version = sim->actor_state_epoch;
+  const player_t* p = this;
+  while ( true )
+  {
+    version += p->state_epoch;
+
+    const player_t* owner = p->get_owner_or_self();
+    if ( owner == p )
+      break;
+    p = owner;
+  }
+
+  return version;
+}
+
 double player_t::resource_loss( resource_e resource_type, double amount, gain_t* source, action_t* )
 {
   if ( amount == 0 )
@@ -5932,6 +6016,8 @@ double player_t::resource_loss( resource_e resource_type, double amount, gain_t*
   if ( current.sleeping )
     return 0.0;
 
+  invalidate_state();
+
   if ( resource_type && resource_type == primary_resource() )
     uptimes.primary_resource_cap->update( false, sim->current_time() );
 
@@ -5987,6 +6073,8 @@ double player_t::resource_gain( resource_e resource_type, double amount, gain_t*
   if ( current.sleeping || amount == 0.0 )
     return 0.0;
 
+  invalidate_state();
+
   double actual_amount = std::min( amount, resources.max[ resource_type ] - resources.current[ resource_type ] );
 
   if ( actual_amount > 0.0 )
@@ -6847,7 +6935,7 @@ void player_t::do_damage( action_state_t* incoming_state )
     // On damage/heal in. Proc flags are arranged as such that the "incoming"
     // version of the primary proc flag is always follows the outgoing version.
     if ( pt != PROC1_INVALID && pt2 != PROC2_INVALID )
-      action_callback_t::trigger( callbacks.procs[ pt + 1 ][ pt2 ], incoming_state->action, incoming_state );
+      callbacks.trigger( static_cast<proc_types>( pt + 1 ), pt2, incoming_state->action, incoming_state );
   }
 
   // Check if target is dying
@@ -7070,17 +7158,17 @@ pet_t* player_t::find_pet( util::string_view name ) const
 
 stats_t* player_t::find_stats( util::string_view name ) const
 {
-  return find_vector_member( stats_list, name );
+  return stats_index.find( stats_list, name );
 }
 
 gain_t* player_t::find_gain( util::string_view name ) const
 {
-  return find_vector_member( gain_list, name );
+  return gain_index.find( gain_list, name );
 }
 
 proc_t* player_t::find_proc( util::string_view name ) const
 {
-  return find_vector_member( proc_list, name );
+  return proc_index.find( proc_list, name );
 }
 
 sample_data_helper_t* player_t::find_sample_data( util::string_view name ) const
@@ -7100,7 +7188,7 @@ uptime_t* player_t::find_uptime( util::string_view name ) const
 
 cooldown_t* player_t::find_cooldown( util::string_view name ) const
 {
-  return find_vector_member( cooldown_list, name );
+  return cooldown_index.find( cooldown_list, name );
 }
 
 action_t* player_t::find_action( util::string_view name ) const
@@ -7108,6 +7196,15 @@ action_t* player_t::find_action( util::string_view name ) const
   return find_vector_member( action_list, name );
 }
 
+action_variable_t* player_t::find_variable( util::string_view name ) const
+{
+  auto it = range::find_if( variables, [ &name ]( const action_variable_t* var ) {
+    return util::str_compare_ci( name, var->name_ );
+  } );
+
+  return it != variables.end() ? *it : nullptr;
+}
+
 cooldown_t* player_t::get_cooldown( util::string_view name, action_t* a )
 {
   cooldown_t* c = find_cooldown( name );
@@ -10012,18 +10109,17 @@ std::unique_ptr<expr_t> player_t::create_expression( util::string_view expressio
         variable_expr_t( player_t* p, util::string_view name ) : expr_t( "variable" ),
           var_( nullptr )
         {
-          auto it = range::find_if( p->variables, [&name]( const action_variable_t* var ) {
-            return util::str_compare_ci( name, var->name_ );
-          } );
+          action_variable_t* var = p->find_variable( name );
 
-          if ( it == p->variables.end() )
+          if ( !var )
           {
             throw std::invalid_argument( fmt::format( "Player {} no variable named '{}' found",
                   p->name(), name ) );
           }
           else
           {
-            var_ = *it;
+            var->add_reader();
+            var_ = var;
           }
         }
 
@@ -10031,7 +10127,7 @@ std::unique_ptr<expr_t> player_t::create_expression( util::string_view expressio
         { return var_->is_constant( value ); }
 
         double evaluate() override
-        { return var_->current_value_; }
+        { return var_->value(); }
       };
 
       return std::make_unique<variable_expr_t>( this, splits[ 1 ] );
@@ -12351,6 +12447,10 @@ action_t* player_t::select_action( const action_priority_list_t& list,
     if ( a->option.wait_on_ready == 1 )
       break;
 
+    // Skip lines that provably cannot be ready, without evaluating the rest of the line
+    if ( !a->cooldowns_ready() )
+      continue;
+
     if ( a->action_ready() )
     {
       // Execute variable operation, and continue processing
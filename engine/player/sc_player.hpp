@@ -21,8 +21,11 @@
 #include "player_stat_cache.hpp"
 #include "scaling_metric_data.hpp"
 #include "util/cache.hpp"
+#include "util/name_index.hpp"
 #include "dbc/item_database.hpp"
 #include "assessor.hpp"
+#include "action/sc_action_state.hpp"
+#include "sim/sc_option.hpp"
 #include <map>
 #include <set>
 
@@ -118,6 +121,8 @@ struct player_t : public actor_t
   int creation_iteration; // The iteration when this actor was created, -1 for "init"
   size_t actor_index;
   int actor_spawn_index; // a unique identifier for each arise() of the actor
+  // Action state memory, declared before anything holding action states so it is destroyed last
+  action_state_pool_t action_state_pool;
   // (static) attributes - things which should not change during combat
   race_e       race;
   role_e       role;
@@ -174,6 +179,7 @@ struct player_t : public actor_t
 
   // Option Parsing
   std::vector<std::unique_ptr<option_t>> options;
+  option_index_t option_index;
 
   // Stat Timelines to Display
   std::vector<stat_e> stat_timelines;
@@ -300,6 +306,8 @@ struct player_t : public actor_t
   std::string use_apl;
   bool use_default_action_list;
   auto_dispose< std::vector<dot_t*> > dot_list;
+  // Dots on this actor whose state changed in the current iteration
+  std::vector<dot_t*> dirty_dot_list;
   auto_dispose< std::vector<action_priority_list_t*> > action_priority_list;
   std::vector<action_t*> precombat_action_list;
   action_priority_list_t* active_action_list;
@@ -325,12 +333,22 @@ struct player_t : public actor_t
   double tmi_window;
 
   auto_dispose< std::vector<buff_t*> > buff_list;
+  // Buffs whose state changed in the current iteration
+  std::vector<buff_t*> dirty_buff_list;
   auto_dispose< std::vector<proc_t*> > proc_list;
   auto_dispose< std::vector<gain_t*> > gain_list;
   auto_dispose< std::vector<stats_t*> > stats_list;
   auto_dispose< std::vector<benefit_t*> > benefit_list;
   auto_dispose< std::vector<uptime_t*> > uptime_list;
   auto_dispose< std::vector<cooldown_t*> > cooldown_list;
+  // Cooldowns whose state changed in the current iteration
+  std::vector<cooldown_t*> dirty_cooldown_list;
+  // Name indices of the buff, proc, gain, stats and cooldown lists
+  mutable name_index_t<buff_t> buff_index;
+  mutable name_index_t<proc_t> proc_index;
+  mutable name_index_t<gain_t> gain_index;
+  mutable name_index_t<stats_t> stats_index;
+  mutable name_index_t<cooldown_t> cooldown_index;
   auto_dispose< std::vector<real_ppm_t*> > rppm_list;
   auto_dispose< std::vector<shuffled_rng_t*> > shuffled_rng_list;
   std::vector<cooldown_t*> dynamic_cooldown_list;
@@ -598,6 +616,10 @@ struct player_t : public actor_t
 
   bool active_during_iteration;
   const spelleffect_data_t* _mastery; // = find_mastery_spell( specialization() ) -> effectN( 1 );
+  /// Incremented on every change of the state of this actor or its pets that cached and snapshotted
+  /// action values may depend on (buffs, dots, resources, stat caches, action executes). Declared
+  /// before the stat cache, which invalidates on construction.
+  mutable uint64_t state_epoch = 0;
   player_stat_cache_t cache;
   auto_dispose<std::vector<action_variable_t*>> variables;
   std::vector<std::string> action_map;
@@ -773,6 +795,10 @@ public:
   sample_data_helper_t* find_sample_data( util::string_view name ) const;
   action_priority_list_t* find_action_priority_list( util::string_view name ) const;
   int find_action_id( util::string_view name ) const;
+  // APL variable of the given name (case insensitive). Code that consumes the value of the variable
+  // must register itself with action_variable_t::add_reader(), as variables nobody reads are not
+  // evaluated. action_variable_t::value() asserts that it did.
+  action_variable_t* find_variable( util::string_view name ) const;
 
   cooldown_t* get_cooldown( util::string_view name, action_t* action = nullptr );
   real_ppm_t* get_rppm    ( util::string_view );
@@ -1061,6 +1087,15 @@ public:
   player_t* get_owner_or_self()
   { return const_cast<player_t*>(static_cast<const player_t*>(this) -> get_owner_or_self()); }
 
+  /// Mark a change of actor state, see state_epoch
+  void invalidate_state() const;
+
+  /**
+   * Version of the state of this actor, its owners and the sim auras. Changes whenever a value
+   * computed from that state may change, see state_epoch and sim_t::actor_state_epoch.
+   */
+  uint64_t state_version() const;
+
   // T18 Hellfire Citadel class trinket detection
   virtual bool has_t18_class_trinket() const;
 
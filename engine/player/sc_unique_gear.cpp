@@ -10,6 +10,7 @@
 #include "simulationcraft.hpp"
 #include "dbc/racial_spells.hpp"
 #include <cctype>
+#include <unordered_map>
 
 using namespace unique_gear;
 
@@ -301,6 +302,9 @@ void enchants::mark_of_the_thunderlord( special_effect_t& effect )
     void reset() override
     { stat_buff_t::reset(); extensions = 0; }
 
+    bool is_reset() const override
+    { return stat_buff_t::is_reset() && extensions == 0; }
+
     void expire_override( int expiration_stacks, timespan_t remaining_duration ) override
     { stat_buff_t::expire_override( expiration_stacks, remaining_duration ); extensions = 0; }
   };
@@ -2606,6 +2610,9 @@ struct hammering_blows_buff_t : public stat_buff_t
 
     stack_driver -> deactivate();
   }
+
+  bool is_reset() const override
+  { return stat_buff_t::is_reset() && !stack_driver -> active; }
 };
 
 struct hammering_blows_driver_cb_t : public dbc_proc_callback_t
@@ -2753,6 +2760,9 @@ struct mark_of_doom_t : public buff_t
 
     driver_cb -> deactivate();
   }
+
+  bool is_reset() const override
+  { return buff_t::is_reset() && !driver_cb -> active; }
 };
 
 // Prophecy of Fear base driver, handles the proccing (triggering) of Mark of Doom on targets
@@ -3630,12 +3640,9 @@ void unique_gear::initialize_special_effect( special_effect_t& effect,
     // Parse auxilary effect options before doing spell data based parsing
     if ( ! dbitem -> encoded_options.empty() )
     {
-      std::string encoded_options = dbitem -> encoded_options;
-      for ( size_t i = 0; i < encoded_options.length(); i++ )
-        encoded_options[ i ] = std::tolower( encoded_options[ i ] );
       // Note, if the encoding parse fails (this should never ever happen),
       // we don't parse game client data either.
-      special_effect::parse_special_effect_encoding( effect, encoded_options );
+      special_effect::parse_special_effect_encoding( effect, dbitem -> encoded_options, dbitem -> encoded_tokens );
     }
     else if ( dbitem -> cb_obj )
     {
@@ -4202,6 +4209,10 @@ namespace unique_gear
 
 std::vector<special_effect_db_item_t> __special_effect_db, __fallback_effect_db;
 
+// Database entries to use for each spell id, built by sort_special_effects()
+std::unordered_map<unsigned, special_effect_set_t> __special_effect_index, __fallback_effect_index;
+bool __special_effect_db_frozen = false;
+
 bool class_scoped_callback_t::valid(const special_effect_t& effect) const
 {
   assert(effect.player);
@@ -4274,14 +4285,43 @@ static unique_gear::special_effect_set_t do_find_special_effect_db_item(
   return entries;
 }
 
-static special_effect_set_t find_fallback_effect_db_item( unsigned spell_id )
-{ return do_find_special_effect_db_item( __fallback_effect_db, spell_id ); }
+static std::unordered_map<unsigned, special_effect_set_t> index_special_effect_db(
+    const std::vector<special_effect_db_item_t>& db )
+{
+  std::unordered_map<unsigned, special_effect_set_t> index;
+
+  for ( const auto& dbitem : db )
+  {
+    if ( ! index.count( dbitem.spell_id ) )
+    {
+      index[ dbitem.spell_id ] = do_find_special_effect_db_item( db, dbitem.spell_id );
+    }
+  }
+
+  return index;
+}
+
+static const special_effect_set_t& find_indexed_effect_db_item(
+    const std::unordered_map<unsigned, special_effect_set_t>& index, unsigned spell_id )
+{
+  static const special_effect_set_t __empty;
 
-special_effect_set_t unique_gear::find_special_effect_db_item( unsigned spell_id )
-{ return do_find_special_effect_db_item( __special_effect_db, spell_id ); }
+  assert( __special_effect_db_frozen && "Special effect database accessed before sort_special_effects()" );
+
+  auto it = index.find( spell_id );
+  return it != index.end() ? it -> second : __empty;
+}
+
+static const special_effect_set_t& find_fallback_effect_db_item( unsigned spell_id )
+{ return find_indexed_effect_db_item( __fallback_effect_index, spell_id ); }
+
+const special_effect_set_t& unique_gear::find_special_effect_db_item( unsigned spell_id )
+{ return find_indexed_effect_db_item( __special_effect_index, spell_id ); }
 
 void unique_gear::add_effect( const special_effect_db_item_t& dbitem )
 {
+  assert( ! __special_effect_db_frozen && "Special effect registered after sort_special_effects()" );
+
   __special_effect_db.push_back( dbitem );
   if ( dbitem.fallback )
     __fallback_effect_db.push_back( dbitem );
@@ -4303,7 +4343,7 @@ void unique_gear::register_special_effect( unsigned spell_id, const char* encode
   dbitem.spell_id = spell_id;
   dbitem.encoded_options = encoded_str;
 
-  __special_effect_db.push_back( dbitem );
+  add_effect( dbitem );
 }
 
 bool unique_gear::create_fallback_buffs( const special_effect_t& effect, const std::vector<util::string_view>& names )
@@ -4656,7 +4696,7 @@ void unique_gear::initialize_special_effect_fallbacks( player_t* actor )
     fallback_effect.type = SPECIAL_EFFECT_FALLBACK;
 
     // Get all registered fallback effects for the spell (fallback) id
-    auto dbitems = find_fallback_effect_db_item( fallback_id );
+    const auto& dbitems = find_fallback_effect_db_item( fallback_id );
     // .. nothing found, continue
     if ( dbitems.size() == 0 )
     {
@@ -4718,5 +4758,21 @@ void unique_gear::sort_special_effects()
 {
   range::sort( __special_effect_db, cmp_special_effect );
   range::sort( __fallback_effect_db, cmp_special_effect );
+
+  // Encoded options are case insensitive, parse them once here instead of for every special effect
+  // that uses them
+  for ( auto& dbitem : __special_effect_db )
+  {
+    if ( ! dbitem.encoded_options.empty() )
+    {
+      util::tolower( dbitem.encoded_options );
+      dbitem.encoded_tokens = item_database::parse_tokens( dbitem.encoded_options );
+    }
+  }
+
+  // The databases do not change after this, so the entries for each spell can be indexed
+  __special_effect_index = index_special_effect_db( __special_effect_db );
+  __fallback_effect_index = index_special_effect_db( __fallback_effect_db );
+  __special_effect_db_frozen = true;
 }
 
@@ -6,6 +6,9 @@
 #pragma once
 
 #include <string>
+#include <vector>
+
+#include "dbc/item_database.hpp"
 
 struct scoped_callback_t;
 
@@ -13,6 +16,8 @@ struct special_effect_db_item_t
 {
   unsigned spell_id;
   std::string encoded_options;
+  // Tokens of the (lowercased) encoded options, parsed when the database is frozen
+  std::vector<item_database::token_t> encoded_tokens;
   scoped_callback_t* cb_obj;
   bool fallback;
 
@@ -10,6 +10,7 @@
 #include "util/timespan.hpp"
 #include "util/sample_data.hpp"
 #include "util/string_view.hpp"
+#include "util/symbol.hpp"
 #include "sim/gain.hpp"
 #include "player/gear_stats.hpp"
 
@@ -27,6 +28,7 @@ private:
   sim_t& sim;
 public:
   const std::string name_str;
+  const util::symbol_t name_symbol;
   player_t* player;
   stats_t* parent;
   // We should make school and type const or const-like, and either stricly define when, where and who defines the values,
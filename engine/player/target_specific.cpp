@@ -5,6 +5,7 @@
 
 #include "target_specific.hpp"
 #include "player/sc_player.hpp"
+#include "sim/sc_sim.hpp"
 
 namespace target_specific_helper
 {
@@ -12,4 +13,9 @@ namespace target_specific_helper
   {
     return player->actor_index;
   }
+
+  size_t get_actor_capacity(const player_t* player)
+  {
+    return player->sim->actor_list.capacity();
+  }
 }
\ No newline at end of file
@@ -7,6 +7,7 @@
 
 #include "config.hpp"
 #include "util/generic.hpp"
+#include <algorithm>
 #include <vector>
 
 struct player_t;
@@ -14,6 +15,8 @@ struct player_t;
 namespace target_specific_helper
 {
   size_t get_actor_index(const player_t* player);
+  // Number of actors the sim of player has room for, see adds_event_t for reserving room up front
+  size_t get_actor_capacity(const player_t* player);
 }
 
 template < class T >
@@ -30,7 +33,7 @@ public:
     auto target_index = target_specific_helper::get_actor_index(target);
     if ( data.size() <= target_index)
     {
-      data.resize(target_index + 1 );
+      grow( target, target_index );
     }
     return data[target_index];
   }
@@ -46,5 +49,12 @@ public:
     return data;
   }
 private:
+  // Size the storage for every actor of the sim at once, so the first lookup of a target does not
+  // resize it for each new actor index again during combat.
+  void grow( const player_t* target, size_t target_index ) const
+  {
+    data.resize( std::max( target_index + 1, target_specific_helper::get_actor_capacity( target ) ) );
+  }
+
   mutable std::vector<T*> data;
 };
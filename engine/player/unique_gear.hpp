@@ -34,11 +34,12 @@ void register_special_effects();
 void register_special_effects_legion();  // Legion special effects
 void register_special_effects_bfa();     // Battle for Azeroth special effects
 
+// Sort and index the special effect database. No special effects can be registered afterwards.
 void sort_special_effects();
 void unregister_special_effects();
 
 void add_effect( const special_effect_db_item_t& );
-special_effect_set_t find_special_effect_db_item( unsigned spell_id );
+const special_effect_set_t& find_special_effect_db_item( unsigned spell_id );
 
 void register_target_data_initializers( sim_t* );
 void register_target_data_initializers_legion( sim_t* );  // Legion targetdata initializers
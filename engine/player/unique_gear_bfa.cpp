@@ -3742,9 +3742,11 @@ void items::azsharas_font_of_power( special_effect_t& effect )
   {
     buff_t* buff;
     action_t* use_action;  // if this exists, then we're prechanneling via the APL
+    action_variable_t* channel_variable;  // APL override of the precombat channel time
 
     latent_arcana_channel_t( const special_effect_t& e, buff_t* b )
-      : generic_proc_t( e, "latent_arcana", e.driver() ), buff( b ), use_action( nullptr )
+      : generic_proc_t( e, "latent_arcana", e.driver() ), buff( b ), use_action( nullptr ),
+        channel_variable( nullptr )
     {
       effect    = &e;
       channeled = true;
@@ -3762,20 +3764,26 @@ void items::azsharas_font_of_power( special_effect_t& effect )
       }
     }
 
+    void init_finished() override
+    {
+      generic_proc_t::init_finished();
+
+      // The channel time is read in precombat_buff(), register as a reader so the variable is
+      // evaluated
+      channel_variable = player->find_variable( "font_of_power_precombat_channel" );
+      if ( channel_variable )
+      {
+        channel_variable->add_reader();
+      }
+    }
+
     void precombat_buff()
     {
       timespan_t time = sim->bfa_opts.font_of_power_precombat_channel;
 
-      if ( time == 0_ms )  // No global override, check for an override from an APL variable
+      if ( time == 0_ms && channel_variable )  // No global override, check for an override from an APL variable
       {
-        for ( auto v : player->variables )
-        {
-          if ( v->name_ == "font_of_power_precombat_channel" )
-          {
-            time = timespan_t::from_seconds( v->value() );
-            break;
-          }
-        }
+        time = timespan_t::from_seconds( channel_variable->value() );
       }
 
       // if ( time == 0_ms )  // No options override, first apply any spec-based hardcoded timings
@@ -3686,6 +3686,9 @@ struct poisoned_dreams_t : public buff_t
 
     driver_cb -> deactivate();
   }
+
+  bool is_reset() const override
+  { return buff_t::is_reset() && !driver_cb -> active; }
 };
 
 // Prophecy of Fear base driver, handles the proccing ( triggering ) of Mark of Doom on targets
@@ -4655,6 +4658,9 @@ struct focused_lightning_t : public stat_buff_t
 
     reverse = false;
   }
+
+  bool is_reset() const override
+  { return stat_buff_t::is_reset() && !reverse; }
 };
 
 void item::stormsinger_fulmination_charge( special_effect_t& effect )
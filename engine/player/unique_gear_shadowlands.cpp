@@ -1558,6 +1558,9 @@ void shadowgrasp_totem( special_effect_t& effect )
       retarget_event = nullptr;
     }
 
+    bool is_reset() const override
+    { return buff_t::is_reset() && retarget_event == nullptr; }
+
     void trigger_target_death( const player_t* actor )
     {
       if ( !check() || !actor->is_enemy() || action->parent->target != actor )
@@ -919,23 +919,84 @@ void iteration_data_to_json( JsonOutput root, const std::vector<iteration_data_e
   } );
 }
 
-void profileset_json2( const profileset::profilesets_t& profileset, const sim_t& sim, js::JsonOutput& root )
+// Add the result of a single profileset to the results array
+void profileset_json2( const profileset::profilesets_t::profileset_entry_t& profileset, const sim_t& sim, js::JsonOutput& results )
 {
-root[ "metric" ] = util::scale_metric_type_string( sim.profileset_metric.front() );
+  const auto& result = profileset -> result();
 
-  auto results = root[ "results" ].make_array();
+  if ( result.mean() == 0 )
+  {
+    return;
+  }
+
+  auto&& obj = results.add();
+
+  obj[ "name" ] = profileset -> name();
+  obj[ "mean" ] = result.mean();
+  obj[ "min" ] = result.min();
+  obj[ "max" ] = result.max();
+  obj[ "stddev" ] = result.stddev();
+  obj["mean_stddev"] = result.mean_stddev();
+  obj["mean_error"] = result.mean_stddev() * sim.confidence_estimator;
+
+  if ( result.median() != 0 )
+  {
+    obj[ "median" ] = result.median();
+    obj[ "first_quartile" ] = result.first_quartile();
+    obj[ "third_quartile" ] = result.third_quartile();
+  }
 
-  range::for_each( profileset.profilesets(), [ &results, &sim ]( const profileset::profilesets_t::profileset_entry_t& profileset ) {
-    const auto& result = profileset -> result();
+  obj[ "iterations" ] = as<uint64_t>( result.iterations() );
 
-    if ( result.mean() == 0 )
+  if ( profileset -> results() > 1 )
+  {
+    auto results2 = obj[ "additional_metrics" ].make_array();
+    for ( size_t midx = 1; midx < sim.profileset_metric.size(); ++midx )
     {
-      return;
+      auto obj2 = results2.add();
+      const auto& result = profileset -> result( sim.profileset_metric[ midx ] );
+
+      obj2[ "metric" ] = util::scale_metric_type_string( sim.profileset_metric[ midx ] );
+      obj2[ "mean" ] = result.mean();
+      obj2[ "min" ] = result.min();
+      obj2[ "max" ] = result.max();
+      obj2[ "stddev" ] = result.stddev();
+      obj2[ "mean_stddev" ] = result.mean_stddev();
+      obj2[ "mean_error" ] = result.mean_stddev() * sim.confidence_estimator;
+
+      if ( result.median() != 0 )
+      {
+        obj2[ "median" ] = result.median();
+        obj2[ "first_quartile" ] = result.first_quartile();
+        obj2[ "third_quartile" ] = result.third_quartile();
+      }
     }
+  }
+
+  // Optional override ouput data
+  if ( ! sim.profileset_output_data.empty() ) {
+    const auto& output_data = profileset -> output_data();
+    // TODO: Create the overrides object only if there is at least one override registered
+    auto ovr = obj[ "overrides" ];
+    profileset::fetch_output_data( output_data, ovr);
+  }
+}
+
+// Add the results of a single profileset to the results array
+void profileset_json3( const profileset::profilesets_t::profileset_entry_t& profileset, const sim_t& sim, js::JsonOutput& results )
+{
+  auto&& obj = results.add();
+  obj[ "name" ] = profileset -> name();
+  auto results_obj = obj[ "metrics" ].make_array();
+  
+  for ( size_t midx = 0; midx < sim.profileset_metric.size(); ++midx )
+  {
+    const auto& result = profileset -> result( sim.profileset_metric[ midx ] );
 
-    auto&& obj = results.add();
+    
+    auto&& obj = results_obj.add();
 
-    obj[ "name" ] = profileset -> name();
+    obj[ "metric" ] = util::scale_metric_type_string( sim.profileset_metric[ midx ] );
     obj[ "mean" ] = result.mean();
     obj[ "min" ] = result.min();
     obj[ "max" ] = result.max();
@@ -951,101 +1012,119 @@ root[ "metric" ] = util::scale_metric_type_string( sim.profileset_metric.front()
     }
 
     obj[ "iterations" ] = as<uint64_t>( result.iterations() );
+  }
+  
+  // Optional override ouput data
+  if ( ! sim.profileset_output_data.empty() ) {
+    const auto& output_data = profileset -> output_data();
+    // TODO: Create the overrides object only if there is at least one override registered
+    auto ovr = obj[ "overrides" ];
+    profileset::fetch_output_data( output_data, ovr);
+  }
+}
+
+/**
+ * Streams the JSON report to the output through a SAX writer. Each section of the report is built
+ * into a short-lived DOM that is written out and released right away, so memory use is bounded by
+ * the largest section (a single actor or profileset result) instead of the whole report.
+ */
+template <typename Writer>
+class json_stream_t
+{
+  Writer& writer_;
 
-    if ( profileset -> results() > 1 )
+  void check( bool accepted )
+  {
+    if ( !accepted )
     {
-      auto results2 = obj[ "additional_metrics" ].make_array();
-      for ( size_t midx = 1; midx < sim.profileset_metric.size(); ++midx )
-      {
-        auto obj2 = results2.add();
-        const auto& result = profileset -> result( sim.profileset_metric[ midx ] );
-
-        obj2[ "metric" ] = util::scale_metric_type_string( sim.profileset_metric[ midx ] );
-        obj2[ "mean" ] = result.mean();
-        obj2[ "min" ] = result.min();
-        obj2[ "max" ] = result.max();
-        obj2[ "stddev" ] = result.stddev();
-        obj2[ "mean_stddev" ] = result.mean_stddev();
-        obj2[ "mean_error" ] = result.mean_stddev() * sim.confidence_estimator;
-
-        if ( result.median() != 0 )
-        {
-          obj2[ "median" ] = result.median();
-          obj2[ "first_quartile" ] = result.first_quartile();
-          obj2[ "third_quartile" ] = result.third_quartile();
-        }
-      }
+      throw std::runtime_error( "JSON Writer did not accept document." );
     }
+  }
 
-    // Optional override ouput data
-    if ( ! sim.profileset_output_data.empty() ) {
-      const auto& output_data = profileset -> output_data();
-      // TODO: Create the overrides object only if there is at least one override registered
-      auto ovr = obj[ "overrides" ];
-      profileset::fetch_output_data( output_data, ovr);
-    }
-  } );
-}
+public:
+  json_stream_t( Writer& writer ) : writer_( writer )
+  { }
 
-void profileset_json3( const profileset::profilesets_t& profilesets, const sim_t& sim, js::JsonOutput& root )
-{
-  auto results = root[ "results" ].make_array();
+  void start_object()
+  { check( writer_.StartObject() ); }
 
-  range::for_each( profilesets.profilesets(), [ &results, &sim ]( const profileset::profilesets_t::profileset_entry_t& profileset ) {
-    
-    auto&& obj = results.add();
-    obj[ "name" ] = profileset -> name();
-    auto results_obj = obj[ "metrics" ].make_array();
-    
-    for ( size_t midx = 0; midx < sim.profileset_metric.size(); ++midx )
-    {
-      const auto& result = profileset -> result( sim.profileset_metric[ midx ] );
+  void end_object()
+  { check( writer_.EndObject() ); }
 
-      
-      auto&& obj = results_obj.add();
+  void start_array()
+  { check( writer_.StartArray() ); }
 
-      obj[ "metric" ] = util::scale_metric_type_string( sim.profileset_metric[ midx ] );
-      obj[ "mean" ] = result.mean();
-      obj[ "min" ] = result.min();
-      obj[ "max" ] = result.max();
-      obj[ "stddev" ] = result.stddev();
-      obj["mean_stddev"] = result.mean_stddev();
-      obj["mean_error"] = result.mean_stddev() * sim.confidence_estimator;
+  void end_array()
+  { check( writer_.EndArray() ); }
 
-      if ( result.median() != 0 )
-      {
-        obj[ "median" ] = result.median();
-        obj[ "first_quartile" ] = result.first_quartile();
-        obj[ "third_quartile" ] = result.third_quartile();
-      }
+  void key( util::string_view name )
+  { check( writer_.Key( name.data(), as<SizeType>( name.size() ) ) ); }
 
-      obj[ "iterations" ] = as<uint64_t>( result.iterations() );
-    }
-    
-    // Optional override ouput data
-    if ( ! sim.profileset_output_data.empty() ) {
-      const auto& output_data = profileset -> output_data();
-      // TODO: Create the overrides object only if there is at least one override registered
-      auto ovr = obj[ "overrides" ];
-      profileset::fetch_output_data( output_data, ovr);
+  // Build members into a temporary object with fn, and write them to the currently open object
+  template <typename Fn>
+  void members( Fn&& fn )
+  {
+    Document doc;
+    doc.SetObject();
+    fn( JsonOutput( doc, doc ) );
+
+    for ( auto it = doc.MemberBegin(); it != doc.MemberEnd(); ++it )
+    {
+      check( writer_.Key( it -> name.GetString(), it -> name.GetStringLength() ) );
+      check( it -> value.Accept( writer_ ) );
     }
-  } );
-}
+  }
 
-void profileset_json( const ::report::json::report_configuration_t& report_configuration, const profileset::profilesets_t& profileset, const sim_t& sim, js::JsonOutput& root )
-{
-  if (report_configuration.version_intersects(">=3.0.0"))
+  // Build elements into a temporary array with fn, and write them to the currently open array
+  template <typename Fn>
+  void elements( Fn&& fn )
   {
-    profileset_json3(profileset, sim, root);
+    Document doc;
+    doc.SetArray();
+    JsonOutput root( doc, doc );
+    fn( root );
+
+    for ( auto it = doc.Begin(); it != doc.End(); ++it )
+    {
+      check( it -> Accept( writer_ ) );
+    }
   }
-  else
+};
+
+template <typename Writer>
+void profileset_json( const ::report::json::report_configuration_t& report_configuration, const profileset::profilesets_t& profilesets, const sim_t& sim, json_stream_t<Writer>& stream )
+{
+  bool v3 = report_configuration.version_intersects(">=3.0.0");
+
+  stream.start_object();
+
+  if ( !v3 )
   {
-    profileset_json2(profileset, sim, root);
+    stream.members( [ &sim ]( JsonOutput root ) {
+      root[ "metric" ] = util::scale_metric_type_string( sim.profileset_metric.front() );
+    } );
   }
-  
+
+  stream.key( "results" );
+  stream.start_array();
+  range::for_each( profilesets.profilesets(), [ &stream, &sim, v3 ]( const profileset::profilesets_t::profileset_entry_t& profileset ) {
+    stream.elements( [ &profileset, &sim, v3 ]( JsonOutput& results ) {
+      if ( v3 )
+      {
+        profileset_json3( profileset, sim, results );
+      }
+      else
+      {
+        profileset_json2( profileset, sim, results );
+      }
+    } );
+  } );
+  stream.end_array();
+
+  stream.end_object();
 }
 
-void to_json( const ::report::json::report_configuration_t& report_configuration, JsonOutput root, const sim_t& sim )
+void sim_options_to_json( JsonOutput root, const sim_t& sim )
 {
   // Sim-scope options
   auto options_root = root[ "options" ];
@@ -1135,19 +1214,10 @@ void to_json( const ::report::json::report_configuration_t& report_configuration
     overrides[ "target_health" ] = sim.overrides.target_health;
   }
 
-  // Players
-  JsonOutput players_arr = root[ "players" ].make_array();
-
-  range::for_each( sim.player_no_pet_list.data(), [ & ]( const player_t* p ) {
-    to_json( players_arr, report_configuration, *p );
-  } );
-
-  if ( sim.profilesets.n_profilesets() > 0 )
-  {
-    auto profileset_root = root[ "profilesets" ];
-    profileset_json( report_configuration, sim.profilesets, sim, profileset_root );
-  }
+}
 
+void sim_statistics_to_json( JsonOutput root, const sim_t& sim )
+{
   auto stats_root = root[ "statistics" ];
   stats_root[ "elapsed_cpu_seconds" ] = chrono::to_fp_seconds(sim.elapsed_cpu);
   stats_root[ "elapsed_time_seconds" ] = chrono::to_fp_seconds(sim.elapsed_time);
@@ -1162,125 +1232,156 @@ void to_json( const ::report::json::report_configuration_t& report_configuration
   add_non_zero( stats_root, "total_dmg", sim.total_dmg );
   add_non_zero( stats_root, "total_heal", sim.total_heal );
   add_non_zero( stats_root, "total_absorb", sim.total_absorb );
+}
 
-  if ( sim.report_details != 0 )
+void sim_details_to_json( JsonOutput root, const sim_t& sim )
+{
+  // Raid events
+  if ( ! sim.raid_events.empty() )
   {
-    // Targets
-    JsonOutput targets_arr = root[ "targets" ].make_array();
+    auto arr = root[ "raid_events" ].make_array();
 
-    range::for_each( sim.target_list.data(), [ & ]( const player_t* p ) {
-      to_json( targets_arr, report_configuration, *p );
+    range::for_each( sim.raid_events, [ & ]( const std::unique_ptr<raid_event_t>& event ) {
+      to_json( arr, *event );
     } );
+  }
 
-    // Raid events
-    if ( ! sim.raid_events.empty() )
-    {
-      auto arr = root[ "raid_events" ].make_array();
-
-      range::for_each( sim.raid_events, [ & ]( const std::unique_ptr<raid_event_t>& event ) {
-        to_json( arr, *event );
-      } );
-    }
-
-    if ( sim.buff_list.size() > 0 )
-    {
-      JsonOutput buffs_arr = root[ "sim_auras" ].make_array();
-      range::for_each( sim.buff_list, [ & ]( const buff_t* b ) {
-        if ( b -> avg_start.mean() == 0 )
-        {
-          return;
-        }
-        to_json( buffs_arr.add(), b );
-      } );
-    }
+  if ( sim.buff_list.size() > 0 )
+  {
+    JsonOutput buffs_arr = root[ "sim_auras" ].make_array();
+    range::for_each( sim.buff_list, [ & ]( const buff_t* b ) {
+      if ( b -> avg_start.mean() == 0 )
+      {
+        return;
+      }
+      to_json( buffs_arr.add(), b );
+    } );
+  }
 
-    if ( sim.low_iteration_data.size() > 0 )
-    {
-      iteration_data_to_json( root[ "iteration_data" ][ "low" ], sim.low_iteration_data );
-    }
+  if ( sim.low_iteration_data.size() > 0 )
+  {
+    iteration_data_to_json( root[ "iteration_data" ][ "low" ], sim.low_iteration_data );
+  }
 
-    if ( sim.high_iteration_data.size() > 0 )
-    {
-      iteration_data_to_json( root[ "iteration_data" ][ "high" ], sim.high_iteration_data );
-    }
+  if ( sim.high_iteration_data.size() > 0 )
+  {
+    iteration_data_to_json( root[ "iteration_data" ][ "high" ], sim.high_iteration_data );
   }
 }
 
-void normal_print(FileWriteStream& stream, Document& doc, const ::report::json::report_configuration_t& report_configuration  )
+// Stream a list of actors as an array, building one actor at a time
+template <typename Writer>
+void actors_to_json( json_stream_t<Writer>& stream, const ::report::json::report_configuration_t& report_configuration, const std::vector<player_t*>& actors )
 {
-  Writer<FileWriteStream> writer( stream );
-  if (report_configuration.decimal_places > 0)
+  stream.start_array();
+  range::for_each( actors, [ & ]( const player_t* p ) {
+    stream.elements( [ & ]( JsonOutput& arr ) {
+      to_json( arr, report_configuration, *p );
+    } );
+  } );
+  stream.end_array();
+}
+
+template <typename Writer>
+void to_json( const ::report::json::report_configuration_t& report_configuration, json_stream_t<Writer>& stream, const sim_t& sim )
+{
+  stream.start_object();
+
+  stream.members( [ &sim ]( JsonOutput root ) {
+    sim_options_to_json( root, sim );
+  } );
+
+  // Players
+  stream.key( "players" );
+  actors_to_json( stream, report_configuration, sim.player_no_pet_list.data() );
+
+  if ( sim.profilesets.n_profilesets() > 0 )
   {
-    writer.SetMaxDecimalPlaces(report_configuration.decimal_places);
+    stream.key( "profilesets" );
+    profileset_json( report_configuration, sim.profilesets, sim, stream );
   }
-  auto accepted = doc.Accept( writer );
-  if ( !accepted )
+
+  stream.members( [ &sim ]( JsonOutput root ) {
+    sim_statistics_to_json( root, sim );
+  } );
+
+  if ( sim.report_details != 0 )
   {
-    throw std::runtime_error("JSON Writer did not accept document.");
+    // Targets
+    stream.key( "targets" );
+    actors_to_json( stream, report_configuration, sim.target_list.data() );
+
+    stream.members( [ &sim ]( JsonOutput root ) {
+      sim_details_to_json( root, sim );
+    } );
   }
+
+  stream.end_object();
 }
 
-void pretty_print(FileWriteStream& stream, Document& doc, const ::report::json::report_configuration_t& report_configuration  )
+template <typename Writer>
+void print_json( Writer& writer, const sim_t& sim, const ::report::json::report_configuration_t& report_configuration )
 {
-  PrettyWriter<FileWriteStream> writer( stream );
   if (report_configuration.decimal_places > 0)
   {
     writer.SetMaxDecimalPlaces(report_configuration.decimal_places);
   }
-  auto accepted = doc.Accept( writer );
-  if ( !accepted )
-  {
-    throw std::runtime_error("JSON Writer did not accept document.");
-  }
-}
 
-void print_json_pretty( FILE* o, const sim_t& sim, const ::report::json::report_configuration_t& report_configuration )
-{
-  Document doc;
-  Value& v = doc;
-  v.SetObject();
+  json_stream_t<Writer> stream( writer );
 
-  JsonOutput root( doc, v );
+  stream.start_object();
 
-  if (report_configuration.version_intersects(">=3.0.0"))
-  {
-    root["$id"] = fmt::format("https://www.simulationcraft.org/reports/{}.schema.json", report_configuration.version());
-  }
-  root[ "version" ] = SC_VERSION;
-  root[ "report_version" ] = report_configuration.version();
-  root[ "ptr_enabled" ] = SC_USE_PTR;
-  root[ "beta_enabled" ] = SC_BETA;
-  root[ "build_date" ] = __DATE__;
-  root[ "build_time" ] = __TIME__;
-  root[ "timestamp" ] = as<uint64_t>( std::time( nullptr ) );
+  stream.members( [ &report_configuration ]( JsonOutput root ) {
+    if (report_configuration.version_intersects(">=3.0.0"))
+    {
+      root["$id"] = fmt::format("https://www.simulationcraft.org/reports/{}.schema.json", report_configuration.version());
+    }
+    root[ "version" ] = SC_VERSION;
+    root[ "report_version" ] = report_configuration.version();
+    root[ "ptr_enabled" ] = SC_USE_PTR;
+    root[ "beta_enabled" ] = SC_BETA;
+    root[ "build_date" ] = __DATE__;
+    root[ "build_time" ] = __TIME__;
+    root[ "timestamp" ] = as<uint64_t>( std::time( nullptr ) );
 #if defined( SC_NO_NETWORKING )
-  root[ "no_networking" ] = true;
+    root[ "no_networking" ] = true;
 #endif
 
-  if ( git_info::available())
-  {
-    root[ "git_revision" ] = git_info::revision();
-    root[ "git_branch" ] = git_info::branch();
-  }
+    if ( git_info::available())
+    {
+      root[ "git_revision" ] = git_info::revision();
+      root[ "git_branch" ] = git_info::branch();
+    }
+  } );
 
-  to_json( report_configuration, root[ "sim" ], sim );
+  stream.key( "sim" );
+  to_json( report_configuration, stream, sim );
 
-  if ( sim.error_list.size() > 0 )
-  {
-    root[ "notifications" ] = sim.error_list;
-  }
+  stream.members( [ &sim ]( JsonOutput root ) {
+    auto_lock_t lock( sim.error_mutex );
+    if ( sim.error_list.size() > 0 )
+    {
+      root[ "notifications" ] = sim.error_list;
+    }
+  } );
 
+  stream.end_object();
+}
+
+void print_json_pretty( FILE* o, const sim_t& sim, const ::report::json::report_configuration_t& report_configuration )
+{
   std::array<char, 16384> buffer;
   FileWriteStream b( o, buffer.data(), buffer.size() );
   if (report_configuration.pretty_print)
   {
-    pretty_print(b, doc, report_configuration);
+    PrettyWriter<FileWriteStream> writer( b );
+    print_json( writer, sim, report_configuration );
   }
   else
   {
-    normal_print(b, doc, report_configuration);
+    Writer<FileWriteStream> writer( b );
+    print_json( writer, sim, report_configuration );
   }
-  
 }
 
 void print_json_report( sim_t& sim, const ::report::json::report_configuration_t& report_configuration)
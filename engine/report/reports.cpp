@@ -16,6 +16,10 @@
 #include <iostream>
 #include <sstream>
 
+#ifndef SC_NO_THREADING
+#include <thread>
+#endif
+
 // report::print_profiles ===================================================
 namespace report
 {
@@ -239,9 +243,35 @@ void print_suite( sim_t* sim )
     std::cout << "\nGenerating reports...\n";
   }
 
+  // The text report goes first, it builds the processed report information of all reported actors
+  // that the JSON and HTML reports read. Afterwards, JSON and HTML reports only read shared data and
+  // can be generated concurrently.
   report::print_text(sim, sim->report_details != 0);
-  report::print_json(*sim);
-  report::print_html(*sim);
+
+#ifndef SC_NO_THREADING
+  if ( sim->threads > 1 && sim->simulation_length.sum() != 0 )
+  {
+    std::thread json_thread( [ sim ]() { report::print_json( *sim ); } );
+    try
+    {
+      report::print_html( *sim );
+    }
+    catch ( ... )
+    {
+      json_thread.join();
+      throw;
+    }
+    json_thread.join();
+  }
+  else
+#endif
+  {
+    report::print_json(*sim);
+    report::print_html(*sim);
+  }
+
   report::print_profiles(sim);
+
+  sim->profilesets.output_binary(*sim);
 }
 }  // namespace report
\ No newline at end of file
@@ -13,7 +13,14 @@
 #include "sim/scale_factor_control.hpp"
 #include "fmt/chrono.h"
 
+#include <exception>
 #include <iostream>
+#include <sstream>
+
+#ifndef SC_NO_THREADING
+#include <atomic>
+#include <thread>
+#endif
 
 namespace
 {  // UNNAMED NAMESPACE ==========================================
@@ -1044,6 +1051,7 @@ void print_html_masthead( report::sc_html_stream& os, const sim_t& sim )
 
 void print_html_errors( report::sc_html_stream& os, const sim_t& sim )
 {
+  auto_lock_t lock( sim.error_mutex );
   if ( !sim.error_list.empty() )
   {
     os << "<pre class=\"section section-open\" style=\"color: black; background-color: white; font-weight: bold;\">\n";
@@ -1308,6 +1316,86 @@ void print_nothing_to_report( report::sc_html_stream& os, const std::string& rea
      << "</div>\n\n";
 }
 
+/* Html report section of a single actor, rendered into memory so that actor sections can be
+ * generated concurrently and written out in report order.
+ */
+struct html_actor_section_t
+{
+  std::stringbuf buffer;
+  report::sc_html_stream os;
+  std::vector<sim_t::chart_data_entry_t> chart_data;
+  std::exception_ptr error;
+
+  void render( const report::sc_html_stream& parent, player_t& actor )
+  {
+    static_cast<std::ostream&>( os ).rdbuf( &buffer );
+    os.copyfmt( parent );
+
+    try
+    {
+      sim_t::chart_data_capture_t capture;
+      report::print_html_player( os, actor );
+      chart_data = std::move( capture.entries );
+    }
+    catch ( ... )
+    {
+      error = std::current_exception();
+    }
+  }
+};
+
+/* Print the html sections of the given actors, in order. With threading, the sections are rendered
+ * concurrently by up to sim.threads threads. Each section only mutates its own actor's report data,
+ * so all actors passed in must be independent of each other's report data (players and their pets
+ * are, targets read each other's buff lists).
+ */
+void print_html_actors( report::sc_html_stream& os, sim_t& sim, const std::vector<player_t*>& actors )
+{
+#ifndef SC_NO_THREADING
+  auto n_threads = std::min( actors.size(), as<size_t>( std::max( 1, sim.threads ) ) );
+  if ( n_threads > 1 )
+  {
+    std::vector<html_actor_section_t> sections( actors.size() );
+    std::atomic<size_t> next_section( 0 );
+
+    auto worker = [ & ]() {
+      for ( auto idx = next_section++; idx < actors.size(); idx = next_section++ )
+      {
+        sections[ idx ].render( os, *actors[ idx ] );
+      }
+    };
+
+    std::vector<std::thread> threads;
+    for ( size_t i = 1; i < n_threads; ++i )
+    {
+      threads.emplace_back( worker );
+    }
+
+    worker();
+
+    range::for_each( threads, []( std::thread& thread ) { thread.join(); } );
+
+    for ( auto& section : sections )
+    {
+      if ( section.error )
+      {
+        std::rethrow_exception( section.error );
+      }
+
+      os << section.buffer.str();
+      sim.add_chart_data( section.chart_data );
+    }
+
+    return;
+  }
+#endif
+
+  for ( auto actor : actors )
+  {
+    report::print_html_player( os, *actor );
+  }
+}
+
 /* Main function building the html document and calling subfunctions
  */
 void print_html_( report::sc_html_stream& os, sim_t& sim )
@@ -1362,9 +1450,10 @@ void print_html_( report::sc_html_stream& os, sim_t& sim )
   sim.profilesets.output_html( sim, os );
 
   // Report Players
+  std::vector<player_t*> actors;
   for ( auto& player : sim.players_by_name )
   {
-    report::print_html_player( os, *player );
+    actors.push_back( player );
 
     // Pets
     if ( sim.report_pets_separately )
@@ -1372,10 +1461,11 @@ void print_html_( report::sc_html_stream& os, sim_t& sim )
       for ( auto& pet : player->pet_list )
       {
         if ( pet->summoned && !pet->quiet )
-          report::print_html_player( os, *pet );
+          actors.push_back( pet );
       }
     }
   }
+  print_html_actors( os, sim, actors );
 
   print_html_sim_summary( os, sim );
 
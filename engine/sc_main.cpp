@@ -307,6 +307,7 @@ int sim_t::main( const std::vector<std::string>& args )
     {
       try
       {
+        spell_data_expr_t::indexed = spell_query_index;
         spell_query -> evaluate();
         print_spell_query();
       }
@@ -8,6 +8,7 @@
 #include "config.hpp"
 #include "sc_enums.hpp"
 #include "util/string_view.hpp"
+#include "util/symbol.hpp"
 
 #include <array>
 #include <string>
@@ -18,12 +19,14 @@ struct gain_t : private noncopyable
 public:
   std::array<double, RESOURCE_MAX> actual, overflow, count;
   const std::string name_str;
+  const util::symbol_t name_symbol;
 
   gain_t( util::string_view n ) :
     actual(),
     overflow(),
     count(),
-    name_str( n )
+    name_str( n ),
+    name_symbol( util::symbol_t::intern( n ) )
   { }
   void add( resource_e rt, double amount, double overflow_ = 0.0 )
   { actual[ rt ] += amount; overflow[ rt ] += overflow_; count[ rt ]++; }
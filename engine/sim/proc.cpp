@@ -11,6 +11,7 @@ proc_t::proc_t( sim_t& s, util::string_view n )
     iteration_count(),
     last_proc( timespan_t::min() ),
     name_str( n ),
+    name_symbol( util::symbol_t::intern( n ) ),
     interval_sum( "Interval", true ),
     count( "Count", true )
 {
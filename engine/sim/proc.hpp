@@ -7,6 +7,7 @@
 #include "config.hpp"
 #include "util/sample_data.hpp"
 #include "util/string_view.hpp"
+#include "util/symbol.hpp"
 #include "util/timespan.hpp"
 
 #include <string>
@@ -23,6 +24,7 @@ private:
   timespan_t last_proc; // track time of the last proc
 public:
   const std::string name_str;
+  const util::symbol_t name_symbol;
   // These are initialized in SIMPLE mode. Only change mode for infrequent procs to keep memory usage reasonable.
   extended_sample_data_t interval_sum;
   extended_sample_data_t count;
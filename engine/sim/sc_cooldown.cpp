@@ -94,6 +94,7 @@ cooldown_t::cooldown_t( util::string_view n, player_t& p ) :
   sim( *p.sim ),
   player( &p ),
   name_str( n ),
+  name_symbol( util::symbol_t::intern( n ) ),
   duration( 0_ms ),
   ready( ready_init() ),
   reset_react( 0_ms ),
@@ -107,13 +108,17 @@ cooldown_t::cooldown_t( util::string_view n, player_t& p ) :
   execute_types_mask( 0u ),
   current_charge( 1 ),
   recharge_multiplier( 1.0 ),
-  base_duration( 0_ms )
-{ }
+  base_duration( 0_ms ),
+  dirty( false )
+{
+  mark_dirty();
+}
 
 cooldown_t::cooldown_t( util::string_view n, sim_t& s ) :
   sim( s ),
   player( nullptr ),
   name_str( n ),
+  name_symbol( util::symbol_t::intern( n ) ),
   duration( 0_ms ),
   ready( ready_init() ),
   reset_react( 0_ms ),
@@ -127,7 +132,8 @@ cooldown_t::cooldown_t( util::string_view n, sim_t& s ) :
   execute_types_mask( 0u ),
   current_charge( 1 ),
   recharge_multiplier( 1.0 ),
-  base_duration( 0_ms )
+  base_duration( 0_ms ),
+  dirty( false )
 { }
 
 /**
@@ -143,6 +149,8 @@ void cooldown_t::adjust_recharge_multiplier()
     return;
   }
 
+  mark_dirty();
+
   double old_multiplier = recharge_multiplier;
   assert( action && "Only cooldowns with associated action can have their recharge multiplier adjusted." );
   recharge_multiplier = action->recharge_multiplier( *this );
@@ -176,6 +184,8 @@ void cooldown_t::adjust_base_duration()
     return;
   }
 
+  mark_dirty();
+
   timespan_t old_duration = base_duration;
   assert( action && "Only cooldowns with associated action can have their base duration adjusted." );
   base_duration = action->cooldown_base_duration( *this );
@@ -245,6 +255,8 @@ void cooldown_t::adjust( timespan_t amount, bool require_reaction )
   if ( amount == 0_ms )
     return;
 
+  mark_dirty();
+
   // Normal cooldown, just adjust as we see fit
   if ( charges == 1 )
   {
@@ -345,6 +357,46 @@ void cooldown_t::reset_init()
   ready_trigger_event = nullptr;
 }
 
+void cooldown_t::mark_dirty()
+{
+  if ( !dirty && player )
+  {
+    dirty = true;
+    player->dirty_cooldown_list.push_back( this );
+  }
+}
+
+bool cooldown_t::is_reset() const
+{
+  return ready == ready_init() && last_start == 0_ms && last_charged == 0_ms && reset_react == 0_ms &&
+         current_charge == charges && recharge_multiplier == 1.0 && base_duration == duration &&
+         !recharge_event && !ready_trigger_event;
+}
+
+void cooldown_t::reset_dirty( sim_t* sim, util::span<cooldown_t* const> cooldowns,
+                              std::vector<cooldown_t*>& dirty )
+{
+  if ( sim->validate_buff_reset )
+  {
+    for ( auto cooldown : cooldowns )
+    {
+      if ( !cooldown->dirty && !cooldown->is_reset() )
+      {
+        sim->error( "{} changed state without being marked dirty, and was not reset.", *cooldown );
+        cooldown->mark_dirty();
+      }
+    }
+  }
+
+  for ( auto cooldown : dirty )
+  {
+    cooldown->reset_init();
+    cooldown->dirty = false;
+  }
+
+  dirty.clear();
+}
+
 void cooldown_t::reset( bool require_reaction, int charges_ )
 {
   if ( charges_ == 0 )
@@ -352,6 +404,8 @@ void cooldown_t::reset( bool require_reaction, int charges_ )
   if ( charges_ < 0 )
     charges_ = charges;
 
+  mark_dirty();
+
   bool was_down = down();
   ready = ready_init();
 
@@ -411,6 +465,8 @@ void cooldown_t::start( action_t* a, timespan_t _override, timespan_t delay )
     return;
   }
 
+  mark_dirty();
+
   reset_react = 0_ms;
   action = a;
 
@@ -9,10 +9,13 @@
 #include "util/timespan.hpp"
 #include "sc_enums.hpp"
 #include "util/string_view.hpp"
+#include "util/symbol.hpp"
 #include "util/format.hpp"
+#include "util/span.hpp"
 
 #include <string>
 #include <memory>
+#include <vector>
 
 struct action_t;
 struct event_t;
@@ -27,6 +30,7 @@ struct cooldown_t
   sim_t& sim;
   player_t* player;
   std::string name_str;
+  const util::symbol_t name_symbol;
   timespan_t duration;
   timespan_t ready;
   timespan_t reset_react;
@@ -62,6 +66,19 @@ struct cooldown_t
 
   void reset_init();
 
+  // Track the cooldown for the next reset_dirty() of its player. Cooldowns without a player are not
+  // reset between iterations, and are not tracked.
+  void mark_dirty();
+
+  // Whether the cooldown is in the state reset_init() leaves it in
+  bool is_reset() const;
+
+  // Reset the cooldowns marked dirty since the previous call, and clear the list. Cooldowns that are
+  // not marked are in their reset state already. With sim_t::validate_buff_reset, cooldowns in the
+  // list that are not marked are checked for that.
+  static void reset_dirty( sim_t* sim, util::span<cooldown_t* const> cooldowns,
+                           std::vector<cooldown_t*>& dirty );
+
   timespan_t remains() const;
 
   timespan_t current_charge_remains() const;
@@ -109,5 +126,7 @@ struct cooldown_t
   friend void format_to( const cooldown_t&, fmt::format_context::iterator );
 
 private:
+  bool dirty;
+
   void adjust_remaining_duration( double delta ); // Modify the remaining duration of an ongoing cooldown.
 };
\ No newline at end of file
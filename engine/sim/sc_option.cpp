@@ -5,14 +5,27 @@
 
 #include "sc_option.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
 #include <iostream>
+#include <iterator>
+#include <sstream>
 
 #include "fmt/format.h"
 #include "util/io.hpp"
 #include "util/util.hpp"
 #include "util/generic.hpp"
+#include "util/git_info.hpp"
 #include "lib/utf8-cpp/utf8.h"
 
+#if defined( SC_WINDOWS )
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
 namespace { // UNNAMED NAMESPACE ============================================
 
 template <typename Range>
@@ -109,6 +122,151 @@ void do_replace( const option_db_t& opts, std::string& str, std::string::size_ty
   str.replace( begin, end - begin + 1, opts.var_map.at( var ) );
 }
 
+// Parsed profile cache entries: a header, the input files the entry depends on (included name,
+// resolved path and content hash), the template variables after parsing and the parsed options. Strings are stored as a 32-bit
+// length followed by the characters, all integers in native byte order.
+const char     CACHE_MAGIC[ 8 ] = { 'S', 'C', 'O', 'P', 'T', 'C', 'C', 'H' };
+const uint32_t CACHE_VERSION    = 2;
+
+// 64-bit FNV-1a
+uint64_t hash_bytes( util::string_view data, uint64_t hash = 0xcbf29ce484222325ULL )
+{
+  for ( auto c : data )
+  {
+    hash ^= static_cast<uint8_t>( c );
+    hash *= 0x100000001b3ULL;
+  }
+
+  return hash;
+}
+
+uint64_t hash_string( util::string_view str, uint64_t hash )
+{
+  auto size = static_cast<uint32_t>( str.size() );
+  hash = hash_bytes( util::string_view( reinterpret_cast<const char*>( &size ), sizeof( size ) ), hash );
+  return hash_bytes( str, hash );
+}
+
+// The simc build, as parsing rules change between builds. Builds without git information use the
+// build time of this file, which holds the parser.
+util::string_view build_id()
+{
+  if ( git_info::available() )
+  {
+    return git_info::revision();
+  }
+
+  return __DATE__ " " __TIME__;
+}
+
+// Everything that affects the result of parsing a file
+uint64_t cache_key( uint64_t content_hash, const option_db_t& opts )
+{
+  auto hash = hash_bytes( util::string_view( reinterpret_cast<const char*>( &content_hash ),
+                                             sizeof( content_hash ) ) );
+
+  hash = hash_string( SC_VERSION, hash );
+  hash = hash_string( build_id(), hash );
+
+  std::vector<const std::pair<const std::string, std::string>*> vars;
+  for ( const auto& var : opts.var_map )
+  {
+    vars.push_back( &var );
+  }
+  std::sort( vars.begin(), vars.end(), []( const auto* l, const auto* r ) { return l->first < r->first; } );
+
+  for ( const auto* var : vars )
+  {
+    hash = hash_string( var->second, hash_string( var->first, hash ) );
+  }
+
+  for ( const auto& path : opts.auto_path )
+  {
+    hash = hash_string( path, hash );
+  }
+
+  return hash;
+}
+
+bool read_file( const std::string& file_name, std::string& content )
+{
+  io::ifstream input;
+  input.open( file_name );
+  if ( !input.is_open() )
+  {
+    return false;
+  }
+
+  content.assign( std::istreambuf_iterator<char>( input ), std::istreambuf_iterator<char>() );
+  return !input.bad();
+}
+
+unsigned long process_id()
+{
+#if defined( SC_WINDOWS )
+  return GetCurrentProcessId();
+#else
+  return static_cast<unsigned long>( getpid() );
+#endif
+}
+
+// Atomically replace the file to with the file from
+bool replace_file( const std::string& from, const std::string& to )
+{
+#if defined( SC_WINDOWS )
+  return MoveFileExW( io::widen( from ).c_str(), io::widen( to ).c_str(), MOVEFILE_REPLACE_EXISTING ) != 0;
+#else
+  return std::rename( from.c_str(), to.c_str() ) == 0;
+#endif
+}
+
+template <typename T>
+void write_value( std::ostream& out, const T& value )
+{
+  out.write( reinterpret_cast<const char*>( &value ), sizeof( value ) );
+}
+
+void write_string( std::ostream& out, util::string_view str )
+{
+  write_value( out, static_cast<uint32_t>( str.size() ) );
+  out.write( str.data(), str.size() );
+}
+
+// Reader of a cache entry held in memory, any read past the end fails the whole entry
+struct cache_reader_t
+{
+  util::string_view data;
+  bool ok = true;
+
+  template <typename T>
+  T value()
+  {
+    T value {};
+    if ( !ok || data.size() < sizeof( T ) )
+    {
+      ok = false;
+      return value;
+    }
+
+    std::copy_n( data.data(), sizeof( T ), reinterpret_cast<char*>( &value ) );
+    data.remove_prefix( sizeof( T ) );
+    return value;
+  }
+
+  std::string string()
+  {
+    auto size = value<uint32_t>();
+    if ( !ok || data.size() < size )
+    {
+      ok = false;
+      return {};
+    }
+
+    std::string str( data.data(), size );
+    data.remove_prefix( size );
+    return str;
+  }
+};
 
 // Shared data base path
 #ifndef SC_SHARED_DATA
@@ -392,6 +550,9 @@ struct opts_map_t : public option_t
     option_t( name ),
     _ref( ref )
   { }
+
+  bool prefix_match() const override
+  { return true; }
 protected:
   opts::parse_status do_parse( sim_t*, util::string_view n, util::string_view v ) const override
   {
@@ -439,6 +600,9 @@ struct opts_map_list_t : public option_t
     option_t( name ), _ref( ref )
   { }
 
+  bool prefix_match() const override
+  { return true; }
+
 protected:
   opts::parse_status do_parse( sim_t*, util::string_view n, util::string_view v ) const override
   {
@@ -610,6 +774,96 @@ opts::parse_status opts::parse( sim_t*                                      sim,
   return ret;
 }
 
+// option_index_t::update ===================================================
+
+void option_index_t::update( util::span<const std::unique_ptr<option_t>> options )
+{
+  // Options are added to the front or back of the lists, so the ends identify an unchanged list
+  const option_t* first = options.empty() ? nullptr : options.front().get();
+  const option_t* last = options.empty() ? nullptr : options.back().get();
+  if ( options.size() == _size && first == _first && last == _last )
+  {
+    return;
+  }
+
+  _names.clear();
+  _prefixes.clear();
+  for ( size_t i = 0; i < options.size(); ++i )
+  {
+    auto& index = options[ i ]->prefix_match() ? _prefixes : _names;
+    index[ std::string( options[ i ]->name() ) ].push_back( i );
+  }
+
+  _size = options.size();
+  _first = first;
+  _last = last;
+}
+
+// option_index_t::parse ====================================================
+
+opts::parse_status option_index_t::parse( sim_t*                                      sim,
+                                          util::span<const std::unique_ptr<option_t>> options,
+                                          util::string_view                           name,
+                                          util::string_view                           value,
+                                          const opts::parse_status_fn_t&              status_fn )
+{
+  update( options );
+
+  static const std::vector<size_t> __empty;
+  auto find = []( const std::unordered_map<std::string, std::vector<size_t>>& index, util::string_view key )
+              -> const std::vector<size_t>& {
+    auto it = index.find( std::string( key ) );
+    return it != index.end() ? it->second : __empty;
+  };
+
+  // Map-style options match the name up to, and including the last '.', ignoring a trailing '+'
+  util::string_view prefix;
+  if ( !_prefixes.empty() && !name.empty() )
+  {
+    auto dot = name.rfind( '.', name.size() - ( name.back() == '+' ? 2 : 1 ) );
+    if ( dot != util::string_view::npos )
+    {
+      prefix = name.substr( 0, dot + 1 );
+    }
+  }
+
+  const auto& by_name = find( _names, name );
+  const auto& by_prefix = prefix.empty() ? __empty : find( _prefixes, prefix );
+
+  // Try the candidates in list order, as opts::parse() would
+  auto name_it = by_name.begin(), prefix_it = by_prefix.begin();
+  while ( name_it != by_name.end() || prefix_it != by_prefix.end() )
+  {
+    size_t idx;
+    if ( prefix_it == by_prefix.end() || ( name_it != by_name.end() && *name_it < *prefix_it ) )
+    {
+      idx = *name_it++;
+    }
+    else
+    {
+      idx = *prefix_it++;
+    }
+
+    auto ret = options[ idx ]->parse( sim, name, value );
+    if ( ret != opts::parse_status::CONTINUE )
+    {
+      if ( status_fn )
+      {
+        ret = status_fn( ret, name, value );
+      }
+      return ret;
+    }
+  }
+
+  auto ret = opts::parse_status::NOT_FOUND;
+  if ( status_fn )
+  {
+    ret = status_fn( opts::parse_status::NOT_FOUND, name, value );
+  }
+
+  return ret;
+}
+
 // option_t::parse ==========================================================
 
 void opts::parse( sim_t*                                      sim,
@@ -750,6 +1004,12 @@ void option_db_t::parse_token( util::string_view token )
 {
   if ( token == "-" )
   {
+    // Standard input can not be verified later, so nothing that includes it is cached
+    for ( auto& frame : cache_frames )
+    {
+      frame.cacheable = false;
+    }
+
     parse_file( std::cin );
     return;
   }
@@ -774,7 +1034,7 @@ void option_db_t::parse_token( util::string_view token )
     {
       throw std::invalid_argument( fmt::format("Unexpected parameter '{}'. Expected format: name=value", parsed_token) );
     }
-    parse_file( input );
+    parse_input_file( parsed_token, actual_name, input );
     return;
   }
 
@@ -792,6 +1052,18 @@ void option_db_t::parse_token( util::string_view token )
     do_replace( *this, var_name, var_name.find( "$(" ), 1 );
     var_map[ var_name ] = value;
   }
+  else if ( name == "profile_cache" )
+  {
+    // Changes how the rest of the input is parsed, so it is applied immediately instead of being
+    // stored as an option. A file that sets it is not cached, as loading it from the cache would
+    // skip the setting.
+    for ( auto& frame : cache_frames )
+    {
+      frame.cacheable = false;
+    }
+
+    cache_path = value;
+  }
   else if ( name == "input" )
   {
     std::string current_base_name;
@@ -812,7 +1084,7 @@ void option_db_t::parse_token( util::string_view token )
     {
       var_map[ "current_base_name" ] = base_name( actual_name );
     }
-    parse_file( input );
+    parse_input_file( value, actual_name, input );
 
     if ( base_name_it != var_map.end() )
     {
@@ -828,6 +1100,201 @@ void option_db_t::parse_token( util::string_view token )
   }
 }
 
+// option_db_t::parse_input_file ============================================
+
+void option_db_t::parse_input_file( const std::string& name, const std::string& file_name, std::istream& input )
+{
+  if ( cache_path.empty() )
+  {
+    parse_file( input );
+    return;
+  }
+
+  std::string content { std::istreambuf_iterator<char>( input ), std::istreambuf_iterator<char>() };
+  auto content_hash = hash_bytes( content );
+
+  // Files that include this one depend on its contents
+  for ( auto& frame : cache_frames )
+  {
+    frame.files.push_back( { name, file_name, content_hash } );
+  }
+
+  auto cache_file = fmt::format( "{}/{:016x}.simc-opts", cache_path, cache_key( content_hash, *this ) );
+  if ( load_cached( cache_file ) )
+  {
+    return;
+  }
+
+  auto first = size();
+  cache_frames.emplace_back();
+  try
+  {
+    std::istringstream s( content );
+    parse_file( s );
+  }
+  catch ( ... )
+  {
+    cache_frames.pop_back();
+    throw;
+  }
+
+  auto frame = std::move( cache_frames.back() );
+  cache_frames.pop_back();
+
+  if ( frame.cacheable )
+  {
+    store_cached( cache_file, first, frame );
+  }
+}
+
+// option_db_t::load_cached =================================================
+
+bool option_db_t::load_cached( const std::string& cache_file )
+{
+  std::string data;
+  if ( !read_file( cache_file, data ) )
+  {
+    return false;
+  }
+
+  cache_reader_t reader { data };
+  char magic[ sizeof( CACHE_MAGIC ) ];
+  for ( auto& c : magic )
+  {
+    c = reader.value<char>();
+  }
+
+  if ( !reader.ok || !std::equal( std::begin( magic ), std::end( magic ), std::begin( CACHE_MAGIC ) ) ||
+       reader.value<uint32_t>() != CACHE_VERSION )
+  {
+    return false;
+  }
+
+  // Included files are resolved on the search paths again, and checked against the path and
+  // contents they had when the entry was stored. A file added earlier on the search paths shadows
+  // the old one.
+  auto n_files = reader.value<uint32_t>();
+  if ( !reader.ok || n_files > reader.data.size() )
+  {
+    return false;
+  }
+
+  std::vector<cached_file_t> files( n_files );
+  for ( size_t i = 0; reader.ok && i < files.size(); ++i )
+  {
+    files[ i ].name = reader.string();
+    files[ i ].path = reader.string();
+    files[ i ].hash = reader.value<uint64_t>();
+    if ( !reader.ok )
+    {
+      return false;
+    }
+
+    std::string actual_name;
+    io::ifstream input;
+    open_file( input, auto_path, files[ i ].name, actual_name );
+    if ( !input.is_open() || actual_name != files[ i ].path )
+    {
+      return false;
+    }
+
+    std::string content { std::istreambuf_iterator<char>( input ), std::istreambuf_iterator<char>() };
+    if ( input.bad() || hash_bytes( content ) != files[ i ].hash )
+    {
+      return false;
+    }
+  }
+
+  std::unordered_map<std::string, std::string> vars;
+  auto n_vars = reader.value<uint32_t>();
+  for ( uint32_t i = 0; reader.ok && i < n_vars; ++i )
+  {
+    auto name = reader.string();
+    vars[ name ] = reader.string();
+  }
+
+  auto first = size();
+  auto n_options = reader.value<uint32_t>();
+  for ( uint32_t i = 0; reader.ok && i < n_options; ++i )
+  {
+    auto scope = reader.string();
+    auto name = reader.string();
+    auto value = reader.string();
+    add( scope, name, value );
+  }
+
+  if ( !reader.ok || !reader.data.empty() )
+  {
+    erase( begin() + first, end() );
+    return false;
+  }
+
+  var_map = std::move( vars );
+  for ( auto& frame : cache_frames )
+  {
+    frame.files.insert( frame.files.end(), files.begin(), files.end() );
+  }
+
+  return true;
+}
+
+// option_db_t::store_cached ================================================
+
+void option_db_t::store_cached( const std::string& cache_file, size_t first, const cache_frame_t& frame ) const
+{
+  // Failing to write the cache only means the file is parsed again next time. Entries are written
+  // to a temporary file unique to this process and call first, and then atomically replace the
+  // entry, so concurrent readers and writers never see a partial or missing entry.
+  static std::atomic<unsigned> tmp_id { 0 };
+  auto tmp_file = fmt::format( "{}.{}.{}.tmp", cache_file, process_id(), tmp_id++ );
+  {
+    io::ofstream out;
+    out.open( tmp_file, std::ios::out | std::ios::trunc | std::ios::binary );
+    if ( !out.is_open() )
+    {
+      return;
+    }
+
+    out.write( CACHE_MAGIC, sizeof( CACHE_MAGIC ) );
+    write_value( out, CACHE_VERSION );
+
+    write_value( out, static_cast<uint32_t>( frame.files.size() ) );
+    for ( const auto& file : frame.files )
+    {
+      write_string( out, file.name );
+      write_string( out, file.path );
+      write_value( out, file.hash );
+    }
+
+    write_value( out, static_cast<uint32_t>( var_map.size() ) );
+    for ( const auto& var : var_map )
+    {
+      write_string( out, var.first );
+      write_string( out, var.second );
+    }
+
+    write_value( out, static_cast<uint32_t>( size() - first ) );
+    for ( auto it = begin() + first; it != end(); ++it )
+    {
+      write_string( out, it->scope );
+      write_string( out, it->name );
+      write_string( out, it->value );
+    }
+
+    if ( !out.good() )
+    {
+      out.close();
+      std::remove( tmp_file.c_str() );
+      return;
+    }
+  }
+
+  if ( !replace_file( tmp_file, cache_file ) )
+  {
+    std::remove( tmp_file.c_str() );
+  }
+}
+
 // option_db_t::parse_args ==================================================
 
 void option_db_t::parse_args( util::span<const std::string> args )
@@ -915,6 +1382,11 @@ option_db_t::option_db_t()
   // Make sure we only have unique entries
   auto it = std::unique(auto_path.begin(), auto_path.end());
   auto_path.resize( std::distance(auto_path.begin(), it) );
+
+  if ( const char* path = std::getenv( "SIMC_PROFILE_CACHE" ) )
+  {
+    cache_path = path;
+  }
 }
 
 std::unique_ptr<option_t> opt_string( util::string_view n, std::string& v )
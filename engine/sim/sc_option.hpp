@@ -7,6 +7,7 @@
 
 #include "config.hpp"
 
+#include <cstdint>
 #include <string>
 #include <unordered_map>
 #include <functional>
@@ -45,7 +46,10 @@ public:
   opts::parse_status parse( sim_t* sim, util::string_view name, util::string_view value ) const;
   util::string_view name() const
   { return _name; }
-  
+  // Map-style options accept every name that starts with name()
+  virtual bool prefix_match() const
+  { return false; }
+
   friend void format_to( const option_t&, fmt::format_context::iterator );
 protected:
   virtual opts::parse_status do_parse( sim_t*, util::string_view name, util::string_view value ) const = 0;
@@ -68,6 +72,27 @@ void parse( sim_t*, util::string_view context, util::span<const std::unique_ptr<
 void parse( sim_t*, util::string_view context, util::span<const std::unique_ptr<option_t>>, util::span<const util::string_view> strings, const parse_status_fn_t& fn = nullptr );
 }
 
+// Hash index of an option list, parsing a name, value pair with the same result as opts::parse()
+// without going through every option. Options are indexed by name, map-style options by their name
+// prefix. The index is rebuilt on use if the list has changed.
+class option_index_t
+{
+public:
+  opts::parse_status parse( sim_t*, util::span<const std::unique_ptr<option_t>> options,
+                            util::string_view name, util::string_view value,
+                            const opts::parse_status_fn_t& fn = nullptr );
+
+private:
+  // Option positions in the list, by name and by prefix
+  std::unordered_map<std::string, std::vector<size_t>> _names, _prefixes;
+  // Identifies the indexed list
+  size_t _size = 0;
+  const option_t* _first = nullptr;
+  const option_t* _last = nullptr;
+
+  void update( util::span<const std::unique_ptr<option_t>> options );
+};
+
 inline void format_to( const std::unique_ptr<option_t>& option, fmt::format_context::iterator out )
 { 
   format_to(*option, out);
@@ -103,6 +128,14 @@ struct option_db_t : public std::vector<option_tuple_t>
 {
   std::vector<std::string> auto_path;
   std::unordered_map<std::string, std::string> var_map;
+  // Directory of the parsed profile cache, from the profile_cache=<dir> option or the
+  // SIMC_PROFILE_CACHE environment variable. Parsing an input file stores the resulting options in
+  // the cache, keyed by a hash of the file contents, the template variables and search paths in
+  // effect and the simc build, and reuses them when the same file is parsed again. Included files
+  // are resolved on the search paths again and must have their old path and contents. Empty if the
+  // cache is not used. Entries are never evicted, the cache grows with every distinct file and variable combination parsed, and the
+  // directory can be cleared at any time.
+  std::string cache_path;
 
   option_db_t();
   void add( util::string_view scope, util::string_view name, util::string_view value )
@@ -114,4 +147,25 @@ struct option_db_t : public std::vector<option_tuple_t>
   void parse_line( util::string_view line );
   void parse_text( util::string_view text );
   void parse_args( util::span<const std::string> args );
+
+private:
+  // Input file an entry depends on: the name it was included by, the path the name resolved to on
+  // auto_path, and the hash of its contents
+  struct cached_file_t
+  {
+    std::string name, path;
+    uint64_t hash;
+  };
+
+  // Input files read while parsing a file that will be stored in the cache
+  struct cache_frame_t
+  {
+    std::vector<cached_file_t> files;
+    bool cacheable = true;
+  };
+  std::vector<cache_frame_t> cache_frames;
+
+  void parse_input_file( const std::string& name, const std::string& file_name, std::istream& input );
+  bool load_cached( const std::string& cache_file );
+  void store_cached( const std::string& cache_file, size_t first, const cache_frame_t& frame ) const;
 };
@@ -13,6 +13,7 @@
 #include "report/sc_highchart.hpp"
 #include "player/sc_player.hpp"
 #include "item/item.hpp"
+#include "util/io.hpp"
 #include "util/string_view.hpp"
 
 #ifndef SC_NO_THREADING
@@ -461,6 +462,13 @@ const profile_result_t& profile_set_t::result( scale_metric_e metric ) const
   return __default;
 }
 
+const profile_output_data_t& profile_set_t::output_data() const
+{
+  static const profile_output_data_t __default {};
+
+  return m_output_data ? *m_output_data : __default;
+}
+
 profile_result_t& profile_set_t::result( scale_metric_e metric )
 {
   assert( metric != SCALE_METRIC_NONE );
@@ -967,6 +975,277 @@ void profilesets_t::output_progressbar( const sim_t* parent ) const
   fflush( stdout );
 }
 
+namespace
+{
+// Builds the columns of the binary profileset export in memory, and writes them out in the
+// layout described in sc_profileset.hpp (binary::header_t, column_t and string_t):
+//
+//   offset 0               header_t
+//   header.columns_offset  column_t[ n_columns ], directory of the columns in output order
+//   column.offset          n_rows values of the column type (f64, u64, u32 or string_t)
+//   header.strings_offset  string table, strings_size bytes of null terminated strings
+//
+// Each part starts on an 8-byte boundary, padding is zeroes. Columns are, in order:
+//   name                                   string
+//   <metric>.mean, .median, .min, .max,    f64, one group per profileset_metric, <metric> is
+//     .first_quartile, .third_quartile,        the metric abbreviation (e.g. dps)
+//     .stddev, .mean_stddev
+//   <metric>.iterations                    u64
+//   race                                   string, profileset_output_data=race
+//   talents.row1 .. talents.row7           u32 talent ids, profileset_output_data=talents
+//   gear.<slot>.item_id, .item_level       u32, profileset_output_data=gear
+//   stats.<stat>                           f64, profileset_output_data=stats
+//
+// util_scripts/profileset_binary.py reads the format.
+class binary_writer_t
+{
+  using rows_t = profilesets_t::profileset_vector_t;
+
+  const rows_t&                  m_rows;
+  std::vector<binary::column_t>  m_columns;
+  std::vector<std::string>       m_data;
+  std::string                    m_strings;
+
+  template <typename T, typename Fn>
+  void add_column( util::string_view name, binary::column_type_e type, Fn fn )
+  {
+    std::string data;
+    data.reserve( m_rows.size() * sizeof( T ) );
+
+    for ( const auto& row : m_rows )
+    {
+      T value = fn( *row );
+      data.append( reinterpret_cast<const char*>( &value ), sizeof( value ) );
+    }
+
+    m_columns.push_back( { add_string( name ), type, 0 } );
+    m_data.push_back( std::move( data ) );
+  }
+
+  static uint64_t align( uint64_t offset )
+  { return ( offset + 7 ) & ~uint64_t( 7 ); }
+
+  static bool write_padded( FILE* file, const void* data, size_t size, uint64_t& offset )
+  {
+    static const char padding[ 8 ] = {};
+
+    auto padded_size = align( offset + size ) - offset;
+    if ( size && std::fwrite( data, size, 1, file ) != 1 )
+    {
+      return false;
+    }
+
+    if ( padded_size > size && std::fwrite( padding, padded_size - size, 1, file ) != 1 )
+    {
+      return false;
+    }
+
+    offset += padded_size;
+    return true;
+  }
+
+public:
+  binary_writer_t( const rows_t& rows ) : m_rows( rows )
+  { }
+
+  uint32_t add_string( util::string_view str )
+  {
+    auto offset = as<uint32_t>( m_strings.size() );
+    m_strings.append( str.data(), str.size() );
+    m_strings.push_back( '\0' );
+    return offset;
+  }
+
+  template <typename Fn>
+  void add_f64( util::string_view name, Fn fn )
+  { add_column<double>( name, binary::COLUMN_F64, fn ); }
+
+  template <typename Fn>
+  void add_u64( util::string_view name, Fn fn )
+  { add_column<uint64_t>( name, binary::COLUMN_U64, fn ); }
+
+  template <typename Fn>
+  void add_u32( util::string_view name, Fn fn )
+  { add_column<uint32_t>( name, binary::COLUMN_U32, fn ); }
+
+  template <typename Fn>
+  void add_str( util::string_view name, Fn fn )
+  {
+    add_column<binary::string_t>( name, binary::COLUMN_STRING, [ this, &fn ]( const profile_set_t& row ) {
+      util::string_view str = fn( row );
+      return binary::string_t { add_string( str ), as<uint32_t>( str.size() ) };
+    } );
+  }
+
+  bool write( FILE* file )
+  {
+    binary::header_t header {};
+    range::copy( binary::MAGIC, header.magic );
+    header.version        = binary::VERSION;
+    header.byte_order     = binary::ENDIAN_MARK;
+    header.n_rows         = m_rows.size();
+    header.n_columns      = m_columns.size();
+    header.columns_offset = align( sizeof( header ) );
+
+    auto offset = align( header.columns_offset + m_columns.size() * sizeof( binary::column_t ) );
+    for ( size_t i = 0; i < m_columns.size(); ++i )
+    {
+      m_columns[ i ].offset = offset;
+      offset = align( offset + m_data[ i ].size() );
+    }
+
+    header.strings_offset = offset;
+    header.strings_size   = m_strings.size();
+
+    offset = 0;
+    if ( ! write_padded( file, &header, sizeof( header ), offset ) ||
+         ! write_padded( file, m_columns.data(), m_columns.size() * sizeof( binary::column_t ), offset ) )
+    {
+      return false;
+    }
+
+    for ( const auto& data : m_data )
+    {
+      if ( ! write_padded( file, data.data(), data.size(), offset ) )
+      {
+        return false;
+      }
+    }
+
+    return write_padded( file, m_strings.data(), m_strings.size(), offset );
+  }
+};
+
+bool has_output_data( const sim_t& sim, const std::string& option )
+{
+  return range::find( sim.profileset_output_data, option ) != sim.profileset_output_data.end();
+}
+} // unnamed namespace
+
+void profilesets_t::output_binary( const sim_t& sim ) const
+{
+  if ( m_profilesets.size() == 0 || sim.profileset_binary_file_str.empty() )
+  {
+    return;
+  }
+
+  binary_writer_t writer( m_profilesets );
+
+  writer.add_str( "name", []( const profile_set_t& p ) { return util::string_view( p.name() ); } );
+
+  for ( auto metric : sim.profileset_metric )
+  {
+    auto prefix = util::scale_metric_type_abbrev( metric );
+
+    writer.add_f64( fmt::format( "{}.mean", prefix ), [ metric ]( const profile_set_t& p ) { return p.result( metric ).mean(); } );
+    writer.add_f64( fmt::format( "{}.median", prefix ), [ metric ]( const profile_set_t& p ) { return p.result( metric ).median(); } );
+    writer.add_f64( fmt::format( "{}.min", prefix ), [ metric ]( const profile_set_t& p ) { return p.result( metric ).min(); } );
+    writer.add_f64( fmt::format( "{}.max", prefix ), [ metric ]( const profile_set_t& p ) { return p.result( metric ).max(); } );
+    writer.add_f64( fmt::format( "{}.first_quartile", prefix ), [ metric ]( const profile_set_t& p ) { return p.result( metric ).first_quartile(); } );
+    writer.add_f64( fmt::format( "{}.third_quartile", prefix ), [ metric ]( const profile_set_t& p ) { return p.result( metric ).third_quartile(); } );
+    writer.add_f64( fmt::format( "{}.stddev", prefix ), [ metric ]( const profile_set_t& p ) { return p.result( metric ).stddev(); } );
+    writer.add_f64( fmt::format( "{}.mean_stddev", prefix ), [ metric ]( const profile_set_t& p ) { return p.result( metric ).mean_stddev(); } );
+    writer.add_u64( fmt::format( "{}.iterations", prefix ), [ metric ]( const profile_set_t& p ) { return as<uint64_t>( p.result( metric ).iterations() ); } );
+  }
+
+  // Output data is only recorded when it differs from the baseline actor, absent values are empty
+  // strings or zeroes.
+  if ( has_output_data( sim, "race" ) )
+  {
+    writer.add_str( "race", []( const profile_set_t& p ) {
+      auto race = p.output_data().race();
+      return util::string_view( race != RACE_NONE ? util::race_type_string( race ) : "" );
+    } );
+  }
+
+  if ( has_output_data( sim, "talents" ) )
+  {
+    for ( unsigned row = 0; row < MAX_TALENT_ROWS; ++row )
+    {
+      writer.add_u32( fmt::format( "talents.row{}", row + 1 ), [ row ]( const profile_set_t& p ) {
+        auto it = range::find_if( p.output_data().talents(), [ row ]( const talent_data_t* talent ) {
+          return talent -> row() == row;
+        } );
+        return it != p.output_data().talents().end() ? ( *it ) -> id() : 0u;
+      } );
+    }
+  }
+
+  if ( has_output_data( sim, "gear" ) )
+  {
+    std::vector<util::string_view> slots;
+    range::for_each( m_profilesets, [ &slots ]( const profileset_entry_t& p ) {
+      for ( const auto& item : p -> output_data().gear() )
+      {
+        if ( range::find( slots, item.slot_name() ) == slots.end() )
+        {
+          slots.emplace_back( item.slot_name() );
+        }
+      }
+    } );
+
+    for ( auto slot : slots )
+    {
+      auto find_item = [ slot ]( const profile_set_t& p ) {
+        return range::find_if( p.output_data().gear(), [ slot ]( const profile_output_data_item_t& item ) {
+          return slot == item.slot_name();
+        } );
+      };
+
+      writer.add_u32( fmt::format( "gear.{}.item_id", slot ), [ &find_item ]( const profile_set_t& p ) {
+        auto it = find_item( p );
+        return it != p.output_data().gear().end() ? it -> item_id() : 0u;
+      } );
+      writer.add_u32( fmt::format( "gear.{}.item_level", slot ), [ &find_item ]( const profile_set_t& p ) {
+        auto it = find_item( p );
+        return it != p.output_data().gear().end() ? it -> item_level() : 0u;
+      } );
+    }
+  }
+
+  if ( has_output_data( sim, "stats" ) )
+  {
+    using stat_fn_t = double ( profile_output_data_t::* )() const;
+    static const std::pair<const char*, stat_fn_t> stats[] = {
+      { "stamina", &profile_output_data_t::stamina },
+      { "agility", &profile_output_data_t::agility },
+      { "intellect", &profile_output_data_t::intellect },
+      { "strength", &profile_output_data_t::strength },
+      { "crit_rating", &profile_output_data_t::crit_rating },
+      { "crit_pct", &profile_output_data_t::crit_pct },
+      { "haste_rating", &profile_output_data_t::haste_rating },
+      { "haste_pct", &profile_output_data_t::haste_pct },
+      { "mastery_rating", &profile_output_data_t::mastery_rating },
+      { "mastery_pct", &profile_output_data_t::mastery_pct },
+      { "versatility_rating", &profile_output_data_t::versatility_rating },
+      { "versatility_pct", &profile_output_data_t::versatility_pct },
+      { "avoidance_rating", &profile_output_data_t::avoidance_rating },
+      { "avoidance_pct", &profile_output_data_t::avoidance_pct },
+      { "leech_rating", &profile_output_data_t::leech_rating },
+      { "leech_pct", &profile_output_data_t::leech_pct },
+      { "speed_rating", &profile_output_data_t::speed_rating },
+      { "speed_pct", &profile_output_data_t::speed_pct },
+      { "corruption", &profile_output_data_t::corruption },
+      { "corruption_resistance", &profile_output_data_t::corruption_resistance },
+    };
+
+    for ( const auto& stat : stats )
+    {
+      auto fn = stat.second;
+      writer.add_f64( fmt::format( "stats.{}", stat.first ), [ fn ]( const profile_set_t& p ) {
+        return ( p.output_data().*fn )();
+      } );
+    }
+  }
+
+  io::cfile file( sim.profileset_binary_file_str, "wb" );
+  if ( ! file || ! writer.write( file ) )
+  {
+    const_cast<sim_t&>( sim ).errorf( "Unable to write profileset binary output file '%s'.",
+      sim.profileset_binary_file_str.c_str() );
+  }
+}
+
 void profilesets_t::output_text( const sim_t& sim, std::ostream& out ) const
 {
   if ( m_profilesets.size() == 0 )
@@ -1178,6 +1457,7 @@ void create_options( sim_t* sim )
     return true;
   } ) );
 
+  sim -> add_option( opt_string( "profileset_binary_output", sim -> profileset_binary_file_str ) );
   sim -> add_option( opt_int( "profileset_work_threads", sim -> profileset_work_threads ) );
   sim -> add_option( opt_int( "profileset_init_threads", sim -> profileset_init_threads ) );
 }
@@ -1432,6 +1712,7 @@ bool profilesets_t::iterate( sim_t*  ) { return true ;}
 void profilesets_t::output_json( const sim_t&, js::JsonOutput& ) const {}
 void profilesets_t::output_html( const sim_t&, std::ostream& ) const {}
 void profilesets_t::output_text( const sim_t&, std::ostream& ) const {}
+void profilesets_t::output_binary( const sim_t& ) const {}
 }
 
 #endif
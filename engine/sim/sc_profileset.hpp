@@ -6,6 +6,7 @@
 #define SC_PROFILESET_HH
 
 #include <array>
+#include <cstdint>
 #include <vector>
 #include <string>
 
@@ -233,7 +234,11 @@ class profile_output_data_t
             m_corruption_resistance;
 
 public:
-  profile_output_data_t() : m_race ( RACE_NONE )
+  profile_output_data_t() : m_race ( RACE_NONE ),
+    m_crit_rating( 0 ), m_crit_pct( 0 ), m_haste_rating( 0 ), m_haste_pct( 0 ), m_mastery_rating( 0 ),
+    m_mastery_pct( 0 ), m_versatility_rating( 0 ), m_versatility_pct( 0 ), m_agility( 0 ), m_strength( 0 ),
+    m_intellect( 0 ), m_stamina( 0 ), m_avoidance_rating( 0 ), m_avoidance_pct( 0 ), m_leech_rating( 0 ),
+    m_leech_pct( 0 ), m_speed_rating( 0 ), m_speed_pct( 0 ), m_corruption( 0 ), m_corruption_resistance( 0 )
   { }
 
   race_e race() const
@@ -414,7 +419,56 @@ public:
 
     return *m_output_data;
   }
+
+  const profile_output_data_t& output_data() const;
+};
+
+// Columnar binary export of profileset results (profileset_binary_output=<file>). The file can be
+// memory mapped and read in place: a header, the column directory, column data and finally the
+// string table. All offsets are relative to the start of the file, column data is 8-byte aligned,
+// and values are stored in the byte order of the writing machine (see header_t::byte_order).
+//
+// Each column holds one value per profileset, in profileset definition order. String columns hold
+// string_t entries referencing the (null terminated) strings in the string table.
+namespace binary
+{
+const char     MAGIC[ 8 ] = { 'S', 'C', 'P', 'R', 'O', 'F', 'S', 'T' };
+const uint32_t VERSION    = 1;
+const uint32_t ENDIAN_MARK = 0x01020304;
+
+enum column_type_e : uint32_t
+{
+  COLUMN_F64 = 0,
+  COLUMN_U64,
+  COLUMN_U32,
+  COLUMN_STRING
+};
+
+struct header_t
+{
+  char     magic[ 8 ];
+  uint32_t version;
+  uint32_t byte_order;
+  uint64_t n_rows;          // Number of profilesets
+  uint64_t n_columns;
+  uint64_t columns_offset;  // Column directory, n_columns column_t entries
+  uint64_t strings_offset;  // String table
+  uint64_t strings_size;
+};
+
+struct column_t
+{
+  uint32_t name;            // String table offset of the column name
+  uint32_t type;            // column_type_e
+  uint64_t offset;          // Column data, n_rows values of the column type
+};
+
+struct string_t
+{
+  uint32_t offset;          // String table offset
+  uint32_t length;
 };
+} // Namespace binary ends
 
 #ifndef SC_NO_THREADING
 class worker_t
@@ -540,6 +594,7 @@ public:
 
   void output_text( const sim_t& sim, std::ostream& out ) const;
   void output_html( const sim_t& sim, std::ostream& out ) const;
+  void output_binary( const sim_t& sim ) const;
 
   bool is_initializing() const
   { return m_state == INITIALIZING; }
@@ -80,7 +80,7 @@ void progress_bar_t::init()
   else
   {
     interval = sim.work_queue -> size();
-    if ( sim.deterministic || sim.strict_work_queue )
+    if ( sim.strict_work_queue )
     {
       interval *= sim.threads;
     }
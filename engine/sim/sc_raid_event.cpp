@@ -237,6 +237,11 @@ struct adds_event_t final : public raid_event_t
       }
     }
 
+    // Reserve room for the adds up front, target specific data of actors is sized to the capacity
+    // of the actor list
+    sim->actor_list.reserve( sim->actor_list.size() +
+                             as<size_t>( util::ceil( overlap ) * util::ceil( count + count_range ) ) );
+
     for ( int i = 0; i < util::ceil( overlap ); i++ )
     {
       for ( unsigned add = 0; add < util::ceil( count + count_range ); add++ )
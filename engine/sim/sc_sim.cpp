@@ -1028,7 +1028,7 @@ struct resource_timeline_collect_event_t : public event_t
   { return "resource_timeline_collect_event_t"; }
   void execute() override
   {
-    if ( sim().iterations == 1 || sim().current_iteration > 0 )
+    if ( sim().collects_iteration_data() )
     {
       if ( ! sim().single_actor_batch )
       {
@@ -1477,6 +1477,7 @@ sim_t::sim_t() :
   progressbar_type( 0 ),
   armory_retries( 3 ),
   allow_experimental_specializations( false ),
+  validate_buff_reset( false ),
   enemy_death_pct( 0 ), rel_target_level( -1 ), target_level( -1 ),
   target_adds( 0 ), desired_targets( 1 ), enable_taunts( false ),
   use_item_verification( true ),
@@ -1487,7 +1488,9 @@ sim_t::sim_t() :
   pvp_crit( false ),
   auto_attacks_always_land( false ),
   active_enemies( 0 ), active_allies( 0 ),
-  _rng(), seed( 0 ), deterministic( 0 ), strict_work_queue( 0 ),
+  _rng(), seed( 0 ), base_seed( 0 ), iteration_index( -1 ), iteration_total( 0 ),
+  iteration_offset( 0 ), strict_iteration_total( 0 ),
+  deterministic( 0 ), strict_work_queue( 0 ),
   average_range( true ), average_gauss( false ),
   fight_style(), add_waves( 0 ), overrides( overrides_t() ),
   default_aura_delay( timespan_t::from_millis( 30 ) ),
@@ -1530,7 +1533,7 @@ sim_t::sim_t() :
   // Multi-Threading
   threads( 0 ), thread_index( 0 ), process_priority( computer_process::BELOW_NORMAL ),
   work_queue( new work_queue_t() ),
-  spell_query(), spell_query_level( MAX_LEVEL ),
+  spell_query(), spell_query_level( MAX_LEVEL ), spell_query_index( true ),
   pause_mutex( nullptr ),
   paused( false ),
   chart_show_relative_difference( false ),
@@ -1541,6 +1544,7 @@ sim_t::sim_t() :
   display_bonus_ids( false ),
   profileset_metric( { SCALE_METRIC_DPS } ),
   profileset_output_data(),
+  profileset_binary_file_str(),
   profileset_enabled( false ),
   profileset_work_threads( 0 ),
   profileset_init_threads( 1 )
@@ -1624,10 +1628,14 @@ sim_t::~sim_t()
 
 double sim_t::iteration_time_adjust()
 {
-  if ( iterations <= 1 )
+  // Deterministic sims adjust by the iteration's position among all iterations, not within the thread
+  int total = deterministic ? iteration_total : iterations;
+  int current = deterministic ? iteration_index : current_iteration;
+
+  if ( total <= 1 )
     return 1.0;
 
-  if ( current_iteration == 0 )
+  if ( current == 0 )
     return 1.0;
 
   // Approximate uniform distribution for fight lengths through randomization when target error is
@@ -1639,6 +1647,10 @@ double sim_t::iteration_time_adjust()
   {
     return rng().range( 1.0 - vary_combat_length, 1.0 + vary_combat_length );
   }
+  else if ( deterministic )
+  {
+    return 1.0 + vary_combat_length * ( ( current % 2 ) ? 1 : -1 ) * current / static_cast<double>( total );
+  }
   else
   {
     auto progress = work_queue -> progress();
@@ -1646,6 +1658,21 @@ double sim_t::iteration_time_adjust()
   }
 }
 
+// sim_t::collects_iteration_data ===========================================
+
+bool sim_t::collects_iteration_data() const
+{
+  // The first iteration of each thread is not collected, in health based sims it determines the
+  // enemy health. Deterministic fixed time sims skip only the first iteration overall, so the
+  // collected iterations are the same for any number of threads.
+  if ( deterministic && fixed_time )
+  {
+    return iteration_total == 1 || iteration_index >= 1;
+  }
+
+  return iterations == 1 || current_iteration >= 1;
+}
+
 // sim_t::expected_max_time =================================================
 
 double sim_t::expected_max_time() const
@@ -1768,14 +1795,18 @@ void sim_t::reset()
     out_debug << "Resetting Simulator";
 
   if( deterministic )
-    seed = rng().reseed();
+  {
+    // Seeded by the iteration number claimed in sim_t::claim_iteration()
+    seed = rng::counter_seed( base_seed, ( uint64_t( current_index ) << 32 ) | unsigned( iteration_index ) );
+    rng().seed( seed );
+    rng().reset();
+  }
 
   event_mgr.reset();
 
   expected_iteration_time = max_time * iteration_time_adjust();
 
-  for ( auto& buff : buff_list )
-    buff -> reset();
+  buff_t::reset_dirty( this, buff_list, dirty_buff_list );
 
   for ( auto& target : target_list )
   {
@@ -1939,7 +1970,7 @@ void sim_t::combat_end()
     b -> expire();
   }
 
-  if ( iterations == 1 || current_iteration >= 1 )
+  if ( collects_iteration_data() )
     datacollection_end();
 
   //assert( active_enemies == 0 );
@@ -2031,7 +2062,7 @@ void sim_t::datacollection_end()
   total_absorb.add( iteration_absorb );
   raid_aps.add( current_time() != timespan_t::zero() ? iteration_absorb / current_time().total_seconds() : 0 );
 
-  if ( deterministic && report_iteration_data > 0 && current_iteration > 0 &&
+  if ( deterministic && report_iteration_data > 0 && collects_iteration_data() &&
        current_time() > timespan_t::zero() )
   {
     // TODO: Metric should be selectable
@@ -2588,6 +2619,7 @@ void sim_t::init()
     }
   }
   _rng.seed( seed + thread_index );
+  base_seed = seed;
 
   if (   queue_lag_stddev == timespan_t::zero() )   queue_lag_stddev =   queue_lag * 0.25;
   if (     gcd_lag_stddev == timespan_t::zero() )     gcd_lag_stddev =     gcd_lag * 0.25;
@@ -2867,10 +2899,12 @@ bool sim_t::iterate()
 
   progress_bar.init();
 
+  // Deterministic sims claim each iteration from the (shared) work queue before simulating it
+  bool more_work = ! deterministic || claim_iteration();
+
   activate_actors();
 
-  bool more_work = true;
-  do
+  while ( more_work && ! canceled )
   {
     ++current_iteration;
     ++work_done;
@@ -2888,6 +2922,10 @@ bool sim_t::iterate()
     {
       current_index = work_queue -> pop();
       more_work = work_queue -> more_work();
+      if ( deterministic )
+      {
+        more_work = claim_iteration();
+      }
 
       if ( more_work && current_index != old_active )
       {
@@ -2903,7 +2941,7 @@ bool sim_t::iterate()
         activate_actors();
       }
     }
-  } while ( more_work && ! canceled );
+  }
 
   if ( ! canceled && progress_bar.update( true, as<int>(current_index) ) )
   {
@@ -2927,6 +2965,28 @@ bool sim_t::iterate()
   return iterations > 0;
 }
 
+// sim_t::claim_iteration ===================================================
+
+bool sim_t::claim_iteration()
+{
+  size_t idx;
+  if ( ! work_queue -> claim( idx, iteration_index, iteration_total ) )
+  {
+    return false;
+  }
+
+  // Number the iterations of a strict work queue among those of all threads, so each thread seeds
+  // a different set of iterations
+  if ( strict_work_queue )
+  {
+    iteration_index += iteration_offset;
+    iteration_total = strict_iteration_total;
+  }
+
+  current_index = idx;
+  return true;
+}
+
 /**
  * @brief pause simulator
  *
@@ -2957,6 +3017,7 @@ void sim_t::set_error(std::string error)
     util::replace_all( error, "\n", "" );
     std::cerr << error << std::endl;
 
+    auto_lock_t lock( error_mutex );
     error_list.push_back( std::move( error ) );
 }
 
@@ -3069,6 +3130,7 @@ void sim_t::run()
 void sim_t::partition()
 {
   iterations = work_queue -> size();
+  strict_iteration_total = iterations;
 
   if ( threads <= 1 )
     return;
@@ -3082,16 +3144,17 @@ void sim_t::partition()
   int remainder = iterations % threads;
   iterations /= threads;
 
-  // Normally we use a shared work-queue to ensure proper load balancing among threads.
-  // However, when we desire deterministic runs (for debugging) we need to force the
-  // sims to each use a specific number of iterations as opposed to using shared pool of work.
+  // Normally we use a shared work-queue to ensure proper load balancing among threads. With
+  // strict_work_queue, the sims each use a specific number of iterations as opposed to using shared
+  // pool of work. Deterministic sims seed each iteration by its number, so they can share the work.
 
-  if ( deterministic || strict_work_queue )
+  if ( strict_work_queue )
   {
     work_queue -> init( iterations );
   }
 
   int num_children = threads - 1;
+  int next_offset = iterations;
 
   sim_control_t* child_control = nullptr;
   // Filter out profileset-related options from the child sim control, since they are not going to
@@ -3120,9 +3183,12 @@ void sim_t::partition()
       remainder--;
     }
 
-    if( deterministic || strict_work_queue )
+    if( strict_work_queue )
     {
       child -> work_queue -> init( child -> iterations );
+      child -> iteration_offset = next_offset;
+      child -> strict_iteration_total = strict_iteration_total;
+      next_offset += child -> iterations;
     }
     else // share the work queue
     {
@@ -3189,9 +3255,8 @@ player_t* sim_t::find_player( int index ) const
 
 cooldown_t* sim_t::get_cooldown( util::string_view name )
 {
-  auto it = range::find( cooldown_list, name, &cooldown_t::name_str );
-  if ( it != cooldown_list.end() )
-    return *it;
+  if ( cooldown_t* c = cooldown_index.find( cooldown_list, name ) )
+    return c;
 
   cooldown_t* c = new cooldown_t( name, *this );
 
@@ -3437,6 +3502,7 @@ void sim_t::create_options()
   add_option( opt_float( "confidence", confidence, 0.0, 1.0 ) );
   add_option( opt_func( "spell_query", parse_spell_query ) );
   add_option( opt_string( "spell_query_xml_output_file", spell_query_xml_output_file_str ) );
+  add_option( opt_bool( "spell_query_index", spell_query_index ) );
   add_option( opt_func( "item_db_source", parse_item_sources ) );
   add_option( opt_func( "proxy", parse_proxy ) );
   add_option( opt_int( "stat_cache", stat_cache ) );
@@ -3445,6 +3511,7 @@ void sim_t::create_options()
   add_option( opt_bool( "single_actor_batch", single_actor_batch ) );
   add_option( opt_bool( "progressbar_type", progressbar_type ) );
   add_option( opt_bool( "allow_experimental_specializations", allow_experimental_specializations ) );
+  add_option( opt_bool( "validate_buff_reset", validate_buff_reset ) );
 
   // Raid buff overrides
   add_option( opt_func( "optimal_raid", parse_optimal_raid ) );
@@ -3819,7 +3886,7 @@ bool sim_t::parse_option( const std::string& name,
 {
   if ( active_player )
   {
-    auto ret = opts::parse( this, active_player->options, name, value );
+    auto ret = active_player->option_index.parse( this, active_player->options, name, value );
 
     // Bail out early on player-specific option error states
     switch ( ret )
@@ -3834,7 +3901,7 @@ bool sim_t::parse_option( const std::string& name,
     }
   }
 
-  auto ret = opts::parse( this, options, name, value );
+  auto ret = option_index.parse( this, options, name, value );
   // With strict_parsing enabled, anything else than "ok" parse status will result in hard failure
   if ( strict_parsing && ret != opts::parse_status::OK )
   {
@@ -3896,7 +3963,7 @@ void sim_t::setup( sim_control_t* c )
                     o.scope, o.name, o.value));
     }
 
-    auto ret = opts::parse( this, p->options, o.name, o.value );
+    auto ret = p->option_index.parse( this, p->options, o.name, o.value );
     if ( ret == opts::parse_status::FAILURE )
     {
       throw std::invalid_argument(fmt::format("Unable to parse option '{}' with value '{}' for player '{}'.",
@@ -4008,7 +4075,7 @@ sim_progress_t sim_t::progress( std::string* detailed, int index )
   }
 
   // For work queues that are independent, collect all work done so far for the progressbar.
-  if ( deterministic || strict_work_queue )
+  if ( strict_work_queue )
   {
     AUTO_LOCK( relatives_mutex );
     for ( const auto& child : children )
@@ -4093,9 +4160,33 @@ void sim_t::abort()
   std::terminate();
 }
 
+namespace
+{
+// Chart data capture of the calling thread, if any
+thread_local sim_t::chart_data_capture_t* chart_data_capture = nullptr;
+}  // unnamed namespace
+
+sim_t::chart_data_capture_t::chart_data_capture_t() : previous( chart_data_capture )
+{
+  chart_data_capture = this;
+}
+
+sim_t::chart_data_capture_t::~chart_data_capture_t()
+{
+  chart_data_capture = previous;
+}
+
 /// add chart to sim for end of report processing
 void sim_t::add_chart_data( const highchart::chart_t& chart )
 {
+  if ( chart_data_capture )
+  {
+    chart_data_capture->entries.emplace_back( chart.toggle_id_str_, chart.toggle_id_str_.empty()
+                                                                    ? chart.to_aggregate_string( false )
+                                                                    : chart.to_data() );
+    return;
+  }
+
   if ( chart.toggle_id_str_.empty() )
   {
     on_ready_chart_data.push_back( chart.to_aggregate_string( false ) );
@@ -4106,6 +4197,22 @@ void sim_t::add_chart_data( const highchart::chart_t& chart )
   }
 }
 
+/// add captured chart data to sim, in capture order
+void sim_t::add_chart_data( const std::vector<chart_data_entry_t>& entries )
+{
+  for ( const auto& entry : entries )
+  {
+    if ( entry.first.empty() )
+    {
+      on_ready_chart_data.push_back( entry.second );
+    }
+    else
+    {
+      chart_data[ entry.first ].push_back( entry.second );
+    }
+  }
+}
+
 void sim_t::print_spell_query()
 {
   if ( ! spell_query_xml_output_file_str.empty() )
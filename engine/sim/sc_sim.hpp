@@ -14,6 +14,7 @@
 #include "sc_profileset.hpp"
 #include "sim_ostream.hpp"
 #include "util/concurrency.hpp"
+#include "util/name_index.hpp"
 #include "util/rng.hpp"
 #include "util/sample_data.hpp"
 #include "util/util.hpp"
@@ -138,6 +139,9 @@ struct sim_t : private sc_thread_t
   int         progressbar_type;
   int         armory_retries;
   bool        allow_experimental_specializations;
+  // Check at the start of each iteration that buffs, cooldowns and dots that were not marked dirty
+  // are in their reset state, reporting an error for each one that is not
+  bool        validate_buff_reset;
 
   // Target options
   double      enemy_death_pct;
@@ -176,12 +180,22 @@ struct sim_t : private sc_thread_t
   int active_allies;
 
   std::vector<std::unique_ptr<option_t>> options;
+  option_index_t option_index;
   std::vector<std::string> party_encoding;
   std::vector<std::string> item_db_sources;
 
   // Random Number Generation
   rng::rng_t _rng;
   uint64_t seed;
+  // Deterministic sims seed each iteration from base_seed and the number of the iteration among all
+  // iterations of the actor batch (over all threads), so results do not depend on the thread count.
+  // Health based sims (fixed_time=0) are the exception, each thread estimates enemy health from its
+  // own previous iterations.
+  uint64_t base_seed;
+  int iteration_index, iteration_total;
+  // With strict_work_queue each thread claims iterations from its own queue. Its iterations are
+  // numbered from iteration_offset among the strict_iteration_total iterations of all threads.
+  int iteration_offset, strict_iteration_total;
   int deterministic;
   int strict_work_queue;
   int average_range, average_gauss;
@@ -379,12 +393,21 @@ struct sim_t : private sc_thread_t
 
   // Auras and De-Buffs
   auto_dispose<std::vector<buff_t*>> buff_list;
+  // Buffs whose state changed in the current iteration
+  std::vector<buff_t*> dirty_buff_list;
+  // Incremented on changes of state shared by all actors that cached and snapshotted action values
+  // may depend on (sim auras, actors arising or demising). Changes of the state of one actor are
+  // tracked by player_t::state_epoch.
+  uint64_t actor_state_epoch = 0;
 
   // Global aura related delay
   timespan_t default_aura_delay;
   timespan_t default_aura_delay_stddev;
 
   auto_dispose<std::vector<cooldown_t*>> cooldown_list;
+  // Name indices of the sim buff and cooldown lists
+  name_index_t<buff_t> buff_index;
+  name_index_t<cooldown_t> cooldown_index;
 
   /// Status of azerite-related effects
   azerite_control azerite_status;
@@ -460,6 +483,7 @@ struct sim_t : private sc_thread_t
 
   // Multi-Threading
   mutex_t merge_mutex;
+  mutable mutex_t error_mutex; // Guards error_list, reports are generated concurrently
   int threads;
   std::vector<sim_t*> children; // Manual delete!
   int thread_index;
@@ -482,15 +506,15 @@ struct sim_t : private sc_thread_t
     using G = nop;
 #endif
     public:
-    std::vector<int> _total_work, _work, _projected_work;
-    size_t index;
+    std::vector<int> _total_work, _work, _projected_work, _claimed;
+    size_t index, claim_index;
 
-    work_queue_t() : index( 0 )
-    { _total_work.resize( 1 ); _work.resize( 1 ); _projected_work.resize( 1 ); }
+    work_queue_t() : index( 0 ), claim_index( 0 )
+    { _total_work.resize( 1 ); _work.resize( 1 ); _projected_work.resize( 1 ); _claimed.resize( 1 ); }
 
     void init( int w )    { G l(m); range::fill( _total_work, w ); range::fill( _projected_work, w ); }
     // Single actor batch sim init methods. Batches is the number of active actors
-    void batches( size_t n ) { G l(m); _total_work.resize( n ); _work.resize( n ); _projected_work.resize( n ); }
+    void batches( size_t n ) { G l(m); _total_work.resize( n ); _work.resize( n ); _projected_work.resize( n ); _claimed.resize( n ); }
 
     void flush()          { G l(m); _total_work[ index ] = _projected_work[ index ] = _work[ index ]; }
     int  size()           { G l(m); return index < _total_work.size() ? _total_work[ index ] : _total_work.back(); }
@@ -537,6 +561,28 @@ struct sim_t : private sc_thread_t
       return index;
     }
 
+    // Claim the next iteration to simulate before simulating it, for deterministic sims that seed
+    // each iteration by its number. Gives the work index, the number of the iteration within it and
+    // the total iterations of the work index. Returns false when every iteration has been claimed.
+    bool claim( size_t& idx, int& iteration, int& total )
+    {
+      G l(m);
+
+      while ( _claimed[ claim_index ] >= _total_work[ claim_index ] )
+      {
+        if ( claim_index == _total_work.size() - 1 )
+        {
+          return false;
+        }
+        ++claim_index;
+      }
+
+      idx = claim_index;
+      iteration = _claimed[ claim_index ]++;
+      total = _total_work[ claim_index ];
+      return true;
+    }
+
     sim_progress_t progress( int idx = -1 );
   };
   std::shared_ptr<work_queue_t> work_queue;
@@ -549,6 +595,7 @@ struct sim_t : private sc_thread_t
   std::unique_ptr<spell_data_expr_t> spell_query;
   unsigned           spell_query_level;
   std::string        spell_query_xml_output_file_str;
+  bool               spell_query_index;
 
   std::unique_ptr<mutex_t> pause_mutex; // External pause mutex, instantiated an external entity (in our case the GUI).
   bool paused;
@@ -563,6 +610,21 @@ struct sim_t : private sc_thread_t
   // to correct elements (toggled elements in the HTML report) based on the data.
   std::map<std::string, std::vector<std::string> > chart_data;
 
+  // Chart data entry (toggle id, data) captured with chart_data_capture_t
+  using chart_data_entry_t = std::pair<std::string, std::string>;
+
+  // Captures the chart data added by the calling thread for the lifetime of the object, instead of
+  // adding it to the sim. Allows report sections to be generated concurrently, and their chart data
+  // to be added to the sim in a deterministic order afterwards.
+  struct chart_data_capture_t : private ::noncopyable
+  {
+    std::vector<chart_data_entry_t> entries;
+    chart_data_capture_t* previous;
+
+    chart_data_capture_t();
+    ~chart_data_capture_t();
+  };
+
   bool chart_show_relative_difference;
   // Which actor to use as the base for computing relative difference.
   std::string relative_difference_base;
@@ -579,6 +641,7 @@ struct sim_t : private sc_thread_t
   opts::map_list_t profileset_map;
   std::vector<scale_metric_e> profileset_metric;
   std::vector<std::string> profileset_output_data;
+  std::string profileset_binary_file_str;
   bool profileset_enabled;
   int profileset_work_threads, profileset_init_threads;
   profileset::profilesets_t profilesets;
@@ -592,6 +655,7 @@ struct sim_t : private sc_thread_t
   virtual void run() override;
   int       main( const std::vector<std::string>& args );
   double    iteration_time_adjust();
+  bool      collects_iteration_data() const;
   double    expected_max_time() const;
   bool      is_canceled() const;
   void      cancel_iteration();
@@ -616,6 +680,7 @@ struct sim_t : private sc_thread_t
   void      merge( sim_t& other_sim );
   void      merge();
   bool      iterate();
+  bool      claim_iteration();
   void      partition();
   bool      execute();
   void      analyze_error();
@@ -660,6 +725,7 @@ struct sim_t : private sc_thread_t
   void combat_begin();
   void combat_end();
   void add_chart_data( const highchart::chart_t& chart );
+  void add_chart_data( const std::vector<chart_data_entry_t>& entries );
   bool has_raid_event( util::string_view type ) const;
 
   // Activates the necessary actor/actors before iteration begins.
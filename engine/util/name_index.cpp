@@ -0,0 +1,96 @@
+// ==========================================================================
+// Dedmonwakeen's Raid DPS/TPS Simulator.
+// Send questions to natehieter@gmail.com
+// ==========================================================================
+
+#include "name_index.hpp"
+
+#ifdef UNIT_TEST
+// Lookups through name_index_t return the same object as a linear search of the list by name
+
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <string>
+
+namespace
+{
+struct named_t
+{
+  std::string name_str;
+  util::symbol_t name_symbol;
+  int source;
+};
+
+named_t* linear_find( const std::vector<named_t*>& list, util::string_view name, int source )
+{
+  for ( auto* obj : list )
+  {
+    if ( obj->name_str == name && ( source < 0 || obj->source == source ) )
+    {
+      return obj;
+    }
+  }
+
+  return nullptr;
+}
+
+int check( name_index_t<named_t>& index, const std::vector<named_t*>& list, const char* what )
+{
+  int failures = 0;
+  for ( auto name : { "alpha", "beta", "gamma", "delta", "epsilon", "missing" } )
+  {
+    for ( int source = -1; source < 2; ++source )
+    {
+      auto found = index.find( list, name, [ source ]( const named_t* obj ) {
+        return source < 0 || obj->source == source;
+      } );
+      if ( found != linear_find( list, name, source ) )
+      {
+        std::cerr << what << ": lookup of '" << name << "' from source " << source << " returned the wrong object\n";
+        ++failures;
+      }
+    }
+  }
+
+  return failures;
+}
+}  // namespace
+
+int main( int /*argc*/, char** /*argv*/ )
+{
+  std::vector<std::unique_ptr<named_t>> objects;
+  for ( auto name : { "delta", "beta", "alpha", "gamma", "beta", "epsilon" } )
+  {
+    objects.emplace_back( new named_t{ name, util::symbol_t::intern( name ), static_cast<int>( objects.size() % 2 ) } );
+  }
+
+  std::vector<named_t*> list;
+  name_index_t<named_t> index;
+  int failures = 0;
+
+  // Grow the list one object at a time, as the get_*() functions do
+  for ( auto& obj : objects )
+  {
+    list.push_back( obj.get() );
+    failures += check( index, list, "append" );
+  }
+
+  // Reorder in place with the last element unchanged, as sorting proc or stats lists can
+  std::sort( list.begin(), list.end() - 1, []( const named_t* l, const named_t* r ) {
+    return l->name_str < r->name_str;
+  } );
+  failures += check( index, list, "sort" );
+
+  std::reverse( list.begin(), list.end() - 1 );
+  failures += check( index, list, "reverse" );
+
+  // Shrink the list
+  list.erase( list.begin() + 1 );
+  failures += check( index, list, "erase" );
+
+  std::cout << ( failures ? "FAILED" : "OK" ) << "\n";
+  return failures ? 1 : 0;
+}
+
+#endif // UNIT_TEST
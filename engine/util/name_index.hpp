@@ -0,0 +1,109 @@
+// ==========================================================================
+// Dedmonwakeen's Raid DPS/TPS Simulator.
+// Send questions to natehieter@gmail.com
+// ==========================================================================
+
+#pragma once
+
+#include "config.hpp"
+
+#include <cstddef>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "util/generic.hpp"
+#include "util/string_view.hpp"
+#include "util/symbol.hpp"
+
+// Hash index of the positions of named objects in a list of pointers, replacing linear searches of
+// the list by name. The objects intern their name when they are created (a name_symbol member next
+// to name_str), the index is keyed by the symbol and its entries are matched by symbol, so a lookup
+// compares integers instead of strings. Looking up a name that was never interned misses without
+// touching the index. Lookups return the same object as a linear search would: the first one in
+// list order that has the name and satisfies the predicate.
+//
+// The index follows the list lazily. Objects appended to the list are indexed on the next lookup,
+// the index is rebuilt if the list shrank or its indexed part changed. Lists are only appended to
+// by the functions that look up a name before creating an object, so the check is done between
+// any removal and a later append. Lists reordered in place (e.g., sorted proc or stats lists) are
+// detected by the entries of a lookup no longer holding their object, which rebuilds the index.
+template <typename T>
+class name_index_t
+{
+  struct entry_t
+  {
+    size_t position;
+    const T* object;
+  };
+
+  std::unordered_map<util::symbol_t, std::vector<entry_t>> _index;
+  size_t _size = 0;
+  const T* _last = nullptr;
+
+  void update( const std::vector<T*>& list, bool rebuild = false )
+  {
+    if ( rebuild || list.size() < _size || ( _size > 0 && list[ _size - 1 ] != _last ) )
+    {
+      _index.clear();
+      _size = 0;
+    }
+
+    for ( size_t i = _size; i < list.size(); ++i )
+    {
+      _index[ list[ i ]->name_symbol ].push_back( { i, list[ i ] } );
+    }
+
+    _size = list.size();
+    _last = _size > 0 ? list.back() : nullptr;
+  }
+
+public:
+  template <typename Predicate>
+  T* find( const std::vector<T*>& list, util::symbol_t symbol, Predicate&& pred )
+  {
+    if ( !symbol )
+    {
+      return nullptr;
+    }
+
+    update( list );
+
+    auto it = _index.find( symbol );
+    if ( it == _index.end() )
+    {
+      return nullptr;
+    }
+
+    // An entry whose object moved means the list was reordered since it was indexed
+    if ( range::any_of( it->second, [ &list ]( const entry_t& e ) { return list[ e.position ] != e.object; } ) )
+    {
+      update( list, true );
+      it = _index.find( symbol );
+      if ( it == _index.end() )
+      {
+        return nullptr;
+      }
+    }
+
+    for ( const auto& e : it->second )
+    {
+      if ( e.object->name_symbol == symbol && pred( list[ e.position ] ) )
+      {
+        return list[ e.position ];
+      }
+    }
+
+    return nullptr;
+  }
+
+  template <typename Predicate>
+  T* find( const std::vector<T*>& list, util::string_view name, Predicate&& pred )
+  { return find( list, util::symbol_t::find( name ), std::forward<Predicate>( pred ) ); }
+
+  T* find( const std::vector<T*>& list, util::symbol_t symbol )
+  { return find( list, symbol, []( const T* ) { return true; } ); }
+
+  T* find( const std::vector<T*>& list, util::string_view name )
+  { return find( list, util::symbol_t::find( name ) ); }
+};
@@ -7,6 +7,7 @@
 
 #include <cstdint>
 #include <algorithm>
+#include <iterator>
 
 // Pseudo-Random Number Generation ==========================================
 
@@ -58,6 +59,39 @@ constexpr uint64_t rotl( const uint64_t x, int k ) {
   return (x << k) | (x >> (64 - k));
 }
 
+// xoshiro256 jump function, equivalent to 2^128 calls to next(). It can be used to generate 2^128
+// non-overlapping subsequences.
+void xoshiro256_jump( uint64_t ( &s )[ 4 ] ) noexcept
+{
+  static constexpr uint64_t JUMP[] = { 0x180ec6d33cfd0aba, 0xd5a61266f0c9392c, 0xa9582618e03fc9aa,
+                                       0x39abdc4529b1661c };
+
+  uint64_t js[4] = { 0, 0, 0, 0 };
+  for ( auto jump : JUMP )
+  {
+    for ( int b = 0; b < 64; ++b )
+    {
+      if ( jump & UINT64_C( 1 ) << b )
+      {
+        for ( unsigned k = 0; k < 4; ++k )
+        {
+          js[k] ^= s[k];
+        }
+      }
+
+      const uint64_t t = s[1] << 17;
+      s[2] ^= s[0];
+      s[3] ^= s[1];
+      s[1] ^= s[2];
+      s[0] ^= s[3];
+      s[2] ^= t;
+      s[3] = rotl(s[3], 45);
+    }
+  }
+
+  std::copy( std::begin( js ), std::end( js ), std::begin( s ) );
+}
+
 } // anon namespace
 
 /**
@@ -118,11 +152,70 @@ void xoshiro256plus_t::seed( uint64_t start ) noexcept
   init_state_from_mix64(s, start);
 }
 
+void xoshiro256plus_t::jump() noexcept
+{
+  xoshiro256_jump( s );
+}
+
 const char* xoshiro256plus_t::name() const noexcept
 {
   return "xoshiro256+";
 }
 
+/**
+ * @brief Batched xoshiro256+ Random Number Generator
+ *
+ * Plain loops over the lanes, written so that they are vectorized.
+ */
+void xoshiro256plus_x4_t::refill() noexcept
+{
+  for ( unsigned i = 0; i < BUFFER_SIZE; i += LANES )
+  {
+    for ( unsigned l = 0; l < LANES; ++l )
+    {
+      buffer[ i + l ] = s[0][l] + s[3][l];
+
+      const uint64_t t = s[1][l] << 17;
+
+      s[2][l] ^= s[0][l];
+      s[3][l] ^= s[1][l];
+      s[1][l] ^= s[2][l];
+      s[0][l] ^= s[3][l];
+
+      s[2][l] ^= t;
+
+      s[3][l] = rotl(s[3][l], 45);
+    }
+  }
+
+  pos = 0;
+}
+
+void xoshiro256plus_x4_t::seed( uint64_t start ) noexcept
+{
+  // Lane l is a xoshiro256+ generator seeded with start and jumped l times, so the lanes are
+  // non-overlapping subsequences
+  uint64_t ls[4];
+  init_state_from_mix64( ls, start );
+
+  for ( unsigned l = 0; l < LANES; ++l )
+  {
+    for ( unsigned k = 0; k < 4; ++k )
+    {
+      s[k][l] = ls[k];
+    }
+
+    xoshiro256_jump( ls );
+  }
+
+  pos = BUFFER_SIZE;
+}
+
+const char* xoshiro256plus_x4_t::name() const noexcept
+{
+  return "xoshiro256+x4";
+}
+
 /**
  * @brief XORSHIFT-1024 Random Number Generator
  *
@@ -149,6 +242,14 @@ const char* xorshift1024_t::name() const noexcept
   return "xorshift1024";
 }
 
+uint64_t counter_seed( uint64_t seed, uint64_t counter )
+{
+  split_mix64_t mix64;
+  mix64.seed( seed );
+  mix64.seed( mix64.next() + counter );
+  return mix64.next();
+}
+
 /**
  * @brief The standard normal CDF, for one random variable.
  *
@@ -326,7 +427,11 @@ double stdnormal_inv( double p )
 
 } // rng
 #ifdef UNIT_TEST
-// Code to test functionality and performance of our RNG implementations
+// Code to test functionality and performance of our RNG implementations. Build and run with
+// "make rng" in engine/. Here the scalar generators are inlined into the benchmark loops, unlike
+// in the engine where they are called from other translation units. For the effect of the batched
+// generator on simulations, time profiles/tests/benchmark_procs.simc (see there) with simc built
+// normally and with -DSC_NO_BATCHED_RNG.
 
 #include <random>
 #include <tuple>
@@ -416,11 +521,47 @@ static void test_uniform_int( rng::basic_rng_t<Engine>& rng, uint64_t n, unsigne
   {
     double pct = static_cast<double>(histogram[ i ]) / n;
     double diff = static_cast<double>(histogram[ i ]) / expected_bucket_size - 1.0;
-    fmt::print("  bucket {:2n}: {:5.2f}% ({}) difference to expected: {:9.6f}%\n", i, pct, histogram[ i ], diff);
+    fmt::print("  bucket {:2}: {:5.2f}% ({}) difference to expected: {:9.6f}%\n", i, pct, histogram[ i ], diff);
   }
   fmt::print("time = {} s\n\n", elapsed_cpu);
 }
 
+// The batched generator returns the values of LANES jumped scalar generators, interleaved lane by
+// lane
+static bool test_batched_streams( uint64_t seed, uint64_t n )
+{
+  using batched_t = rng::xoshiro256plus_x4_t;
+
+  batched_t batched;
+  batched.seed( seed );
+
+  rng::xoshiro256plus_t lanes[ batched_t::LANES ];
+  for ( unsigned l = 0; l < batched_t::LANES; ++l )
+  {
+    lanes[ l ].seed( seed );
+    for ( unsigned j = 0; j < l; ++j )
+    {
+      lanes[ l ].jump();
+    }
+  }
+
+  for ( uint64_t i = 0; i < n; ++i )
+  {
+    uint64_t expected = lanes[ i % batched_t::LANES ].next();
+    uint64_t value = batched.next();
+    if ( value != expected )
+    {
+      fmt::print( "{} value {} is {}, expected {} from lane {}\n\n", batched.name(), i, value, expected,
+                  i % batched_t::LANES );
+      return false;
+    }
+  }
+
+  fmt::print( "{} equals {} interleaved {} streams for {} values\n\n", batched.name(), batched_t::LANES,
+              lanes[ 0 ].name(), n );
+  return true;
+}
+
 namespace detail {
 template <typename Tuple, typename F, std::size_t... I>
 void for_each_impl(Tuple&& t, F&& f, std::index_sequence<I...>)
@@ -439,16 +580,22 @@ void for_each(Tuple&& t, F&& f)
 
 int main( int /*argc*/, char** /*argv*/ )
 {
-  auto generators = std::make_tuple(
-    rng::basic_rng_t<rng::xoshiro256plus_t>{},
-    rng::basic_rng_t<rng::xorshift128_t>{},
-    rng::basic_rng_t<rng::xorshift1024_t>{}
-  );
+  std::tuple<
+    rng::basic_rng_t<rng::xoshiro256plus_t>,
+    rng::basic_rng_t<rng::xoshiro256plus_x4_t>,
+    rng::basic_rng_t<rng::xorshift128_t>,
+    rng::basic_rng_t<rng::xorshift1024_t>
+  > generators;
 
   std::random_device rd;
   uint64_t seed  = uint64_t(rd()) | (uint64_t(rd()) << 32);
   fmt::print( "Seed: {}\n\n", seed );
 
+  if ( !test_batched_streams( seed, 1'000'000 ) )
+  {
+    return 1;
+  }
+
   for_each( generators, [seed]( auto& g ) { g.seed( seed ); } );
 
   for_each( generators, []( auto& g ) { test_one( g, 1'000'000'000 ); } );
@@ -526,6 +673,8 @@ int main( int /*argc*/, char** /*argv*/ )
   fmt::print( "calls to rng::stdnormal_inv( double x )\n" );
   fmt::print( "x=0.975: {:.7} should be equal to 1.959964\n", rng::stdnormal_inv( 0.975 ) );
   fmt::print( "x=0.995: {:.8} should be equal to 2.5758293\n", rng::stdnormal_inv( 0.995 ) );
+
+  return 0;
 }
 
 #endif // UNIT_TEST
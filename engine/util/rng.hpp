@@ -278,11 +278,49 @@ struct xoshiro256plus_t
 {
   uint64_t next() noexcept;
   void seed( uint64_t start ) noexcept;
+  /// Advance the state by 2^128 calls to next()
+  void jump() noexcept;
   const char* name() const noexcept;
 private:
   uint64_t s[4];
 };
 
+/**
+ * @brief Batched xoshiro256+ Random Number Generator
+ *
+ * Runs LANES xoshiro256+ generators side by side, each starting 2^128 steps after the previous one,
+ * and generates BUFFER_SIZE values at a time into a buffer that next() serves from. The lane state
+ * is laid out so that the compiler vectorizes the batch generation (SSE2 / AVX2 / NEON), and next()
+ * is inlined into the distribution functions. The values are those of LANES jumped xoshiro256plus_t
+ * generators, interleaved lane by lane.
+ *
+ * The unit test in rng.cpp (make rng) checks that, and benchmarks it against the scalar generator.
+ */
+struct xoshiro256plus_x4_t
+{
+  static constexpr unsigned LANES = 4;
+  static constexpr unsigned BUFFER_SIZE = 64;
+
+  uint64_t next() noexcept
+  {
+    if ( pos == BUFFER_SIZE )
+    {
+      refill();
+    }
+
+    return buffer[ pos++ ];
+  }
+
+  void seed( uint64_t start ) noexcept;
+  const char* name() const noexcept;
+private:
+  uint64_t s[4][LANES];
+  uint64_t buffer[BUFFER_SIZE];
+  unsigned pos = BUFFER_SIZE;
+
+  void refill() noexcept;
+};
+
 /**
  * @brief XORSHIFT-1024 Random Number Generator
  *
@@ -301,7 +339,16 @@ private:
 
 // "Default" rng
 // Explicitly *NOT* a type alias to allow forward declaraions
+// Define SC_NO_BATCHED_RNG to use the scalar xoshiro256+ generator
+#if defined( SC_NO_BATCHED_RNG )
 struct rng_t : public basic_rng_t<xoshiro256plus_t> {};
+#else
+struct rng_t : public basic_rng_t<xoshiro256plus_x4_t> {};
+#endif
+
+/// Seed derived from a seed and a counter, independent of any generator state. Used to give each
+/// iteration its own stream.
+uint64_t counter_seed( uint64_t seed, uint64_t counter );
 
 double stdnormal_cdf( double );
 double stdnormal_inv( double );
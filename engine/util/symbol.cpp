@@ -0,0 +1,105 @@
+// ==========================================================================
+// Dedmonwakeen's Raid DPS/TPS Simulator.
+// Send questions to natehieter@gmail.com
+// ==========================================================================
+
+#include "symbol.hpp"
+
+#include <array>
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <string>
+
+namespace
+{
+// 64-bit FNV-1a
+uint64_t name_hash( util::string_view name )
+{
+  uint64_t h = 0xcbf29ce484222325ULL;
+  for ( char c : name )
+  {
+    h = ( h ^ static_cast<unsigned char>( c ) ) * 0x100000001b3ULL;
+  }
+  return h;
+}
+
+struct symbol_node_t
+{
+  std::string name;
+  uint64_t hash;
+  uint32_t id;
+  // Set before the node is published and never changed afterwards
+  const symbol_node_t* next;
+};
+
+// Chained hash table with a fixed number of buckets. Nodes are prepended to their bucket under the
+// lock and published with a release store, so readers walk the chains without locking.
+struct symbol_table_t
+{
+  static constexpr size_t BUCKETS = 1 << 14;
+
+  std::array<std::atomic<const symbol_node_t*>, BUCKETS> buckets;
+  std::mutex lock;
+  // Elements of a deque do not move when it grows
+  std::deque<symbol_node_t> nodes;
+
+  symbol_table_t()
+  {
+    for ( auto& b : buckets )
+    {
+      b.store( nullptr, std::memory_order_relaxed );
+    }
+  }
+
+  const symbol_node_t* find( util::string_view name, uint64_t hash ) const
+  {
+    for ( auto n = buckets[ hash % BUCKETS ].load( std::memory_order_acquire ); n; n = n->next )
+    {
+      if ( n->hash == hash && n->name == name )
+      {
+        return n;
+      }
+    }
+
+    return nullptr;
+  }
+};
+
+symbol_table_t& symbol_table()
+{
+  static symbol_table_t table;
+  return table;
+}
+} // unnamed namespace
+
+util::symbol_t util::symbol_t::intern( string_view name )
+{
+  auto& table = symbol_table();
+  auto hash = name_hash( name );
+
+  if ( auto n = table.find( name, hash ) )
+  {
+    return symbol_t( n->id );
+  }
+
+  std::lock_guard<std::mutex> lock( table.lock );
+  if ( auto n = table.find( name, hash ) )
+  {
+    return symbol_t( n->id );
+  }
+
+  auto& bucket = table.buckets[ hash % symbol_table_t::BUCKETS ];
+  auto id = static_cast<uint32_t>( table.nodes.size() + 1 );
+  table.nodes.push_back( { std::string( name.data(), name.size() ), hash, id,
+                           bucket.load( std::memory_order_relaxed ) } );
+  bucket.store( &table.nodes.back(), std::memory_order_release );
+
+  return symbol_t( id );
+}
+
+util::symbol_t util::symbol_t::find( string_view name )
+{
+  auto n = symbol_table().find( name, name_hash( name ) );
+  return n ? symbol_t( n->id ) : symbol_t();
+}
@@ -0,0 +1,64 @@
+// ==========================================================================
+// Dedmonwakeen's Raid DPS/TPS Simulator.
+// Send questions to natehieter@gmail.com
+// ==========================================================================
+
+#pragma once
+
+#include "config.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+#include "util/string_view.hpp"
+
+namespace util
+{
+// Interned name. Names are interned in a process-wide symbol table, shared by all sims and
+// threads, so equal names have the same symbol and comparing or hashing symbols is an integer
+// operation. Objects intern their name when they are created. Looking up a name does not lock, so
+// sims initializing in parallel only serialize on names that have not been interned yet. The table
+// only grows, interned names live until the process exits.
+class symbol_t
+{
+  uint32_t _id;
+
+  explicit constexpr symbol_t( uint32_t id ) : _id( id )
+  { }
+
+public:
+  // No symbol, never equal to an interned name
+  constexpr symbol_t() : _id( 0 )
+  { }
+
+  // Symbol of the name, interning the name if needed
+  static symbol_t intern( string_view name );
+
+  // Symbol of the name if it has been interned, no symbol otherwise. Does not grow the table, so
+  // lookups of unknown names are cheap misses.
+  static symbol_t find( string_view name );
+
+  constexpr uint32_t id() const
+  { return _id; }
+
+  explicit constexpr operator bool() const
+  { return _id != 0; }
+
+  friend constexpr bool operator==( symbol_t l, symbol_t r )
+  { return l._id == r._id; }
+
+  friend constexpr bool operator!=( symbol_t l, symbol_t r )
+  { return l._id != r._id; }
+};
+} // namespace util
+
+namespace std
+{
+template <>
+struct hash<util::symbol_t>
+{
+  size_t operator()( util::symbol_t s ) const noexcept
+  { return s.id(); }
+};
+} // namespace std
@@ -1095,7 +1095,10 @@ void SC_OptionsTab::createToolTips()
 
   choice.deterministic_rng->setToolTip(
       tr( "Deterministic Random Number Generator creates all random numbers with a given, constant seed.\n"
-          "This allows for replicating a specific simulation result." ) );
+          "This allows for replicating a specific simulation result.\n"
+          "Fixed time simulations give the same result with any number of threads. Health based simulations\n"
+          "(fixed_time=0) estimate enemy health on each thread separately, so their result still depends on\n"
+          "the number of threads." ) );
 
   choice.world_lag->setToolTip( tr( "World Lag is the equivalent of the 'world lag' shown in the WoW Client.\n"
                                     "It is currently used to extend the cooldown duration of user executable abilities "
@@ -160,6 +160,7 @@ HEADERS += engine/util/format.hpp
 HEADERS += engine/util/generic.hpp
 HEADERS += engine/util/git_info.hpp
 HEADERS += engine/util/io.hpp
+HEADERS += engine/util/name_index.hpp
 HEADERS += engine/util/plot_data.hpp
 HEADERS += engine/util/rng.hpp
 HEADERS += engine/util/sample_data.hpp
@@ -169,6 +170,7 @@ HEADERS += engine/util/span.hpp
 HEADERS += engine/util/static_map.hpp
 HEADERS += engine/util/stopwatch.hpp
 HEADERS += engine/util/string_view.hpp
+HEADERS += engine/util/symbol.hpp
 HEADERS += engine/util/timeline.hpp
 HEADERS += engine/util/timespan.hpp
 HEADERS += engine/util/util.hpp
@@ -322,9 +324,11 @@ SOURCES += engine/util/chrono.cpp
 SOURCES += engine/util/concurrency.cpp
 SOURCES += engine/util/git_info.cpp
 SOURCES += engine/util/io.cpp
+SOURCES += engine/util/name_index.cpp
 SOURCES += engine/util/rng.cpp
 SOURCES += engine/util/sample_data.cpp
 SOURCES += engine/util/string_view.cpp
+SOURCES += engine/util/symbol.cpp
 SOURCES += engine/util/timeline.cpp
 SOURCES += engine/util/timespan.cpp
 SOURCES += engine/util/util.cpp
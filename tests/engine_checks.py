@@ -0,0 +1,286 @@
+#!/usr/bin/env python3
+#
+# Engine regression checks. Each check runs simc (SIMC_CLI_PATH) on a small profile and verifies a
+# property of its output.
+#
+# Usage: engine_checks.py [check ...]
+#   Runs the given checks, or all of them. SIMC_CHECK_PROFILE overrides the profile used.
+
+import sys, os, re, json, math, subprocess, tempfile, time
+from pathlib import Path
+
+from helper import SIMC_CLI_PATH
+
+ROOT = Path(__file__).resolve().parent.parent
+sys.path.insert(0, str(ROOT / 'util_scripts'))
+
+import profileset_binary
+
+PROFILE = os.environ.get('SIMC_CHECK_PROFILE', str(ROOT / 'profiles' / 'PreRaids' / 'PR_Warrior_Fury.simc'))
+
+# Run simc on the profile, returning the finished process
+def simc(*args, profile=PROFILE, cwd=None, env=None):
+    cmd = [ SIMC_CLI_PATH, profile, 'output={}'.format(os.devnull), 'cleanup_threads=1' ]
+    cmd.extend(args)
+    res = subprocess.run(cmd, stdout=subprocess.PIPE, stderr=subprocess.PIPE, encoding='UTF-8', cwd=cwd, env=env)
+    if res.returncode != 0:
+        raise AssertionError('{} failed with exit status {}:\n{}'.format(' '.join(cmd), res.returncode, res.stderr))
+    return res
+
+# Upper bound of a reaction time, in seconds
+MAX_REACTION = 10.0
+
+def close(a, b):
+    return math.isclose(a, b, rel_tol=1e-9, abs_tol=1e-9)
+
+# The binary profileset output holds the same results as the JSON report
+def check_profileset_binary(tmp):
+    binary = tmp / 'profilesets.bin'
+    report = tmp / 'report.json'
+    simc('iterations=20', 'threads=2', 'profileset_output_data=race',
+         'profileset_metric=dps,dtps',
+         'profileset.orc+=race=orc', 'profileset.haste+=gear_haste_rating=500',
+         'json3={}'.format(report), 'profileset_binary_output={}'.format(binary))
+
+    columns = dict(profileset_binary.read(str(binary)))
+    with report.open() as f:
+        results = json.load(f)['sim']['profilesets']['results']
+
+    assert columns['name'] == [ r['name'] for r in results ], 'profileset names differ'
+    assert columns['race'] == [ 'orc', '' ], 'unexpected race column {}'.format(columns['race'])
+
+    metrics = [ name[:-len('.mean')] for name in columns if name.endswith('.mean') ]
+    assert metrics == [ 'dps', 'dtps' ], 'unexpected metric columns {}'.format(metrics)
+
+    for row, result in enumerate(results):
+        for metric, values in zip(metrics, result['metrics']):
+            for field in ( 'mean', 'min', 'max', 'stddev', 'mean_stddev' ):
+                a, b = columns['{}.{}'.format(metric, field)][row], values[field]
+                assert close(a, b), '{} {}.{}: {} != {}'.format(result['name'], metric, field, a, b)
+            assert columns['{}.iterations'.format(metric)][row] == values['iterations'], \
+                '{} {}.iterations differ'.format(result['name'], metric)
+
+# Seeds of the iterations reported in the JSON iteration data. With report_iteration_data=0.45
+# and fixed time iterations, the low and high entries cover all but one collected iteration.
+def iteration_seeds(tmp, *args):
+    report = tmp / 'report.json'
+    simc('iterations=20', 'threads=2', 'deterministic=1', 'fixed_time=1', 'report_iteration_data=0.45',
+         'json3={}'.format(report), *args)
+
+    with report.open() as f:
+        data = json.load(f)['sim']['iteration_data']
+
+    return [ entry['seed'] for entry in data['low'] + data['high'] ]
+
+# Deterministic sims with a per thread work queue run the same iterations as with a shared one,
+# instead of each thread repeating the same ones
+def check_strict_work_queue_seeds(tmp):
+    strict = iteration_seeds(tmp, 'strict_work_queue=1')
+    shared = iteration_seeds(tmp, 'strict_work_queue=0')
+
+    assert len(set(strict)) == len(strict), 'duplicate iteration seeds {}'.format(sorted(strict))
+    assert sorted(strict) == sorted(shared), \
+        'strict work queue iterations {} differ from shared {}'.format(sorted(strict), sorted(shared))
+
+# Fixed time deterministic sims give the same results with any number of threads. The mean can differ
+# in the last bits, as the per thread results are summed in a different order.
+def check_deterministic_threads(tmp):
+    args = ( 'iterations=200', 'fixed_time=1', 'max_time=120' )
+    single, _ = dps(tmp, 'threads=1', *args)
+    multi, _ = dps(tmp, 'threads=4', *args)
+
+    assert close(single[0], multi[0]), 'mean dps {} with threads=1, {} with threads=4'.format(single[0], multi[0])
+    assert single[1:] == multi[1:], 'dps (min, max) {} with threads=1, {} with threads=4'.format(
+        single[1:], multi[1:])
+
+# With ready_trigger=1, each reactable buff stack has a react ready trigger event. Retriggering the
+# stack reschedules its event relative to the current time, so it never lands further away than a
+# reaction time.
+def check_react_ready_trigger(tmp):
+    log = tmp / 'debug.log'
+    simc('iterations=1', 'threads=1', 'max_time=60', 'debug=1', 'ready_trigger=1', 'output={}'.format(log),
+         profile=str(ROOT / 'profiles' / 'PreRaids' / 'PR_Mage_Frost.simc'))
+
+    executed = 0
+    reschedule = re.compile(r'^(\S+) (?:Rescheduling|Adjusting reschedule of) event react_ready_trigger\(#\d+\) '
+                            r'from \S+ to (\S+)')
+    with log.open(encoding='UTF-8', errors='replace') as f:
+        for line in f:
+            if 'react_ready_trigger' not in line:
+                continue
+
+            if 'Executing event: react_ready_trigger' in line:
+                executed += 1
+                continue
+
+            match = reschedule.match(line)
+            if match:
+                now, to = float(match.group(1)), float(match.group(2))
+                assert to - now <= MAX_REACTION, 'react ready trigger rescheduled {}s ahead: {}'.format(
+                    to - now, line.strip())
+
+    assert executed > 0, 'no react ready trigger events executed'
+
+# Mean, minimum and maximum DPS of the player, and the run time of the sim in seconds
+def dps(tmp, *args, profile=PROFILE):
+    report = tmp / 'report.json'
+    start = time.perf_counter()
+    simc('deterministic=1', 'json3={}'.format(report), *args, profile=profile)
+    elapsed = time.perf_counter() - start
+
+    with report.open() as f:
+        data = json.load(f)['sim']['players'][0]['collected_data']['dps']
+
+    return ( data['mean'], data['min'], data['max'] ), elapsed
+
+PROFILE_DIR = ROOT / 'profiles' / 'PreRaids'
+
+# Aoe profiles, and multi dotting profiles whose target dependent values come from their own debuffs
+# on each target
+AOE_PROFILES = [ 'PR_Warrior_Fury.simc', 'PR_Demon_Hunter_Havoc.simc', 'PR_Mage_Fire.simc',
+                 'PR_Warlock_Affliction.simc', 'PR_Priest_Shadow.simc' ]
+
+# Aoe executes share target independent snapshot values across their targets, and cache action
+# multipliers and target dependent player values. Disabling the stat cache disables all of them,
+# so both runs give the same results.
+def check_aoe_snapshot(tmp):
+    timings = []
+    for profile in AOE_PROFILES:
+        args = ( 'iterations=50', 'threads=1', 'desired_targets=20', 'max_time=120' )
+        cached, cached_time = dps(tmp, 'stat_cache=1', *args, profile=str(PROFILE_DIR / profile))
+        scalar, scalar_time = dps(tmp, 'stat_cache=0', *args, profile=str(PROFILE_DIR / profile))
+
+        assert cached == scalar, '{}: dps (mean, min, max) {} with stat_cache=1, {} with stat_cache=0'.format(
+            profile, cached, scalar)
+        timings.append('{} {:.2f}s/{:.2f}s'.format(profile, cached_time, scalar_time))
+
+    return '20 targets, cached/scalar: ' + ', '.join(timings)
+
+# The player stat cache and the action multiplier cache do not change results of single target
+# sims of any class
+def check_stat_cache(tmp):
+    timings = []
+    for profile in sorted(PROFILE_DIR.glob('PR_*.simc')):
+        args = ( 'iterations=50', 'threads=1', 'max_time=120' )
+        cached, cached_time = dps(tmp, 'stat_cache=1', *args, profile=str(profile))
+        scalar, scalar_time = dps(tmp, 'stat_cache=0', *args, profile=str(profile))
+
+        assert cached == scalar, '{}: dps (mean, min, max) {} with stat_cache=1, {} with stat_cache=0'.format(
+            profile.name, cached, scalar)
+        timings.append(( cached_time, scalar_time ))
+
+    return 'cached/uncached total {:.2f}s/{:.2f}s'.format(sum(t[0] for t in timings), sum(t[1] for t in timings))
+
+# Buffs, cooldowns and dots are only reset when their state changed in the previous iteration.
+# Validation checks that the others, including custom state of buff subclasses, are in their reset
+# state, for every class.
+def check_reset_validation(tmp):
+    for profile in sorted(PROFILE_DIR.glob('PR_*.simc')):
+        res = simc('iterations=5', 'threads=1', 'max_time=120', 'desired_targets=3', 'validate_buff_reset=1',
+                   profile=str(profile))
+        errors = [ line for line in res.stderr.splitlines() if 'without being marked dirty' in line ]
+        assert not errors, '{}: {}'.format(profile.name, '\n'.join(errors))
+
+# Parsed profiles are reused from the profile cache while the profile and its includes are
+# unchanged, and parsed again when an include changes or is shadowed by a file earlier on the search
+# paths
+def check_profile_cache(tmp):
+    cache = tmp / 'cache'
+    cache.mkdir()
+    (tmp / 'profiles').mkdir()
+    (tmp / 'main.simc').write_text('input=include.simc\n')
+    env = dict(os.environ, SIMC_PROFILE_CACHE=str(cache))
+
+    def max_time():
+        report = tmp / 'profile_cache.json'
+        simc('iterations=1', 'threads=1', 'json3={}'.format(report), profile='main.simc', cwd=str(tmp), env=env)
+        with open(report, 'r') as f:
+            return json.load(f)['sim']['options']['max_time']
+
+    def entries():
+        return { p.name: ( p.stat().st_ino, p.stat().st_mtime_ns ) for p in cache.glob('*.simc-opts') }
+
+    (tmp / 'profiles' / 'include.simc').write_text('max_time=100\n')
+    value = max_time()
+    assert close(value, 100), 'first run: max_time {}, expected 100'.format(value)
+    stored = entries()
+    assert stored, 'first run stored no cache entries'
+
+    value = max_time()
+    assert close(value, 100), 'cached run: max_time {}, expected 100'.format(value)
+    assert entries() == stored, 'cached run did not reuse the cache entries'
+
+    (tmp / 'profiles' / 'include.simc').write_text('max_time=150\n')
+    value = max_time()
+    assert close(value, 150), 'changed include: max_time {}, expected 150'.format(value)
+
+    (tmp / 'include.simc').write_text('max_time=200\n')
+    value = max_time()
+    assert close(value, 200), 'shadowed include: max_time {}, expected 200'.format(value)
+
+# Spell queries covering each operator, the class, race, school and label indexes, the value
+# columns of spell, talent and effect fields, and combinations with &, | and -
+SPELL_QUERIES = [
+    'spell.class=mage',
+    'talent.class=priest&talent.row<=3',
+    'spell.race=orc',
+    'spell.school!=physical&spell.class=warrior',
+    'spell.class=hunter&spell.label!=16',
+    'spell.cooldown>=60000&spell.class=paladin',
+    'spell.cooldown>0&spell.cooldown<30000&spell.class=rogue',
+    'spell.gcd<=0&spell.class=druid',
+    '(spell.max_stack>1|spell.charges>1)&spell.class=monk',
+    'spell.effect.type=6&spell.class=shaman',
+    'spell.effect.sub_type!=4&spell.class=warlock',
+    'effect.type=2&effect.base_value>100',
+    'spell.name~fire&spell.class=mage',
+    'spell.name!~frost&spell.class=mage',
+    'spell.class=mage-spell.school=fire',
+    'spell.class=deathknight|spell.class=demonhunter',
+]
+
+# Spell queries answered from the client data indexes give the same results as linear scans of the
+# result lists
+def check_spell_query_index(tmp):
+    for query in SPELL_QUERIES:
+        indexed = simc('spell_query={}'.format(query)).stdout
+        linear = simc('spell_query_index=0', 'spell_query={}'.format(query)).stdout
+
+        assert indexed.strip(), '{}: no results'.format(query)
+        assert indexed == linear, '{}: indexed and linear scan results differ'.format(query)
+
+CHECKS = {
+    'aoe_snapshot': check_aoe_snapshot,
+    'deterministic_threads': check_deterministic_threads,
+    'profile_cache': check_profile_cache,
+    'profileset_binary': check_profileset_binary,
+    'react_ready_trigger': check_react_ready_trigger,
+    'reset_validation': check_reset_validation,
+    'spell_query_index': check_spell_query_index,
+    'stat_cache': check_stat_cache,
+    'strict_work_queue_seeds': check_strict_work_queue_seeds,
+}
+
+def main(names):
+    unknown = [ name for name in names if name not in CHECKS ]
+    if unknown:
+        print('Unknown checks {}, available checks: {}'.format(unknown, list(CHECKS.keys())))
+        return 1
+
+    failures = 0
+    for name in names or CHECKS.keys():
+        print('  {:<60}    '.format(name), end='', flush=True)
+        try:
+            with tempfile.TemporaryDirectory() as tmp:
+                note = CHECKS[name](Path(tmp))
+            print('[PASS]' + ( ' ' + note if note else '' ))
+        except AssertionError as err:
+            print('[FAIL]')
+            print(err)
+            failures += 1
+
+    print('Failed: {}/{}'.format(failures, len(names or CHECKS)))
+    return failures
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))
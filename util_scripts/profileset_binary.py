@@ -0,0 +1,89 @@
+#!/usr/bin/env python3
+#
+# Reader for the columnar binary profileset output of simc (profileset_binary_output=<file>). The
+# layout is described next to the writer in engine/sim/sc_profileset.cpp and by the binary::
+# structs in engine/sim/sc_profileset.hpp.
+#
+# Usage: profileset_binary.py <file> [column ...]
+#   Prints the given columns (all columns by default) of every profileset as CSV.
+
+import struct, sys, csv
+
+MAGIC       = b'SCPROFST'
+VERSION     = 1
+ENDIAN_MARK = 0x01020304
+
+_HEADER = struct.Struct('=8sIIQQQQQ')
+_COLUMN = struct.Struct('=IIQ')
+_STRING = struct.Struct('=II')
+
+# column_type_e: struct format of a value
+_COLUMN_TYPES = {
+    0: 'd', # COLUMN_F64
+    1: 'Q', # COLUMN_U64
+    2: 'I', # COLUMN_U32
+    3: None # COLUMN_STRING, string_t
+}
+
+def _cstring(strings, offset):
+    end = strings.index(b'\0', offset)
+    return strings[offset:end].decode('utf-8')
+
+def read(path):
+    '''Read a profileset binary output file, returns a list of ( column name, values ) tuples in
+    file order, with one value per profileset.'''
+    with open(path, 'rb') as f:
+        data = f.read()
+
+    if len(data) < _HEADER.size:
+        raise ValueError('{}: truncated header'.format(path))
+
+    magic, version, byte_order, n_rows, n_columns, columns_offset, strings_offset, strings_size = \
+        _HEADER.unpack_from(data, 0)
+    if magic != MAGIC:
+        raise ValueError('{}: not a profileset binary output file'.format(path))
+    if version != VERSION:
+        raise ValueError('{}: unsupported version {}, expected {}'.format(path, version, VERSION))
+    if byte_order != ENDIAN_MARK:
+        raise ValueError('{}: written on a machine with a different byte order'.format(path))
+    if strings_offset + strings_size > len(data):
+        raise ValueError('{}: truncated string table'.format(path))
+
+    strings = data[strings_offset:strings_offset + strings_size]
+
+    columns = []
+    for i in range(n_columns):
+        name, type_, offset = _COLUMN.unpack_from(data, columns_offset + i * _COLUMN.size)
+        if type_ not in _COLUMN_TYPES:
+            raise ValueError('{}: unknown type {} of column {}'.format(path, type_, i))
+
+        fmt = _COLUMN_TYPES[type_]
+        if fmt is None:
+            values = [ _cstring(strings, s_offset)
+                       for s_offset, length in _STRING.iter_unpack(data[offset:offset + n_rows * _STRING.size]) ]
+        else:
+            values = list(struct.unpack_from('={}{}'.format(n_rows, fmt), data, offset))
+
+        columns.append(( _cstring(strings, name), values ))
+
+    return columns
+
+def main(args):
+    if len(args) < 1:
+        print('Usage: {} <file> [column ...]'.format(sys.argv[0]), file=sys.stderr)
+        return 1
+
+    columns = read(args[0])
+    if len(args) > 1:
+        by_name = dict(columns)
+        columns = [ ( name, by_name[name] ) for name in args[1:] ]
+
+    writer = csv.writer(sys.stdout)
+    writer.writerow([ name for name, _ in columns ])
+    for row in zip(*( values for _, values in columns )):
+        writer.writerow(row)
+
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))